@@ -0,0 +1,124 @@
+/*
+    A sample scheduler plugin: lottery scheduling.
+
+    Every ready thread holds tickets according to its priority (SYSTEM 8, INTERACTIVE 4,
+    NORMAL 2, BATCH 1). Each decision draws one ticket at random, and the thread holding it
+    runs for one time slice (3 ticks unless -s is given). The random number generator has a
+    fixed seed, so runs are repeatable.
+
+    Build it with "make plugins" and run it with:
+
+        ./cpu-sim --scheduler-plugin ./bin/plugins/lottery.so -v tests/input/input-1
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algorithms/plugin/scheduler_plugin.h"
+
+static const int TICKETS[4] = {8, 4, 2, 1};
+
+typedef struct entry {
+    cpu_sim_thread_handle handle;
+    int tickets;
+} entry;
+
+typedef struct lottery {
+    entry* entries;
+    size_t count;
+    size_t capacity;
+    long total_tickets;
+    int time_slice;
+    uint64_t random_state;
+} lottery;
+
+/* xorshift64: small, fast, and the same on every platform. */
+static uint64_t next_random(lottery* state) {
+    uint64_t x = state->random_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    state->random_state = x;
+    return x;
+}
+
+static void* lottery_create(int time_slice) {
+    lottery* state = calloc(1, sizeof(lottery));
+    if (state == NULL) {
+        return NULL;
+    }
+    state->time_slice = (time_slice > 0) ? time_slice : 3;
+    state->random_state = 0x2545F4914F6CDD1DULL;
+    return state;
+}
+
+static void lottery_destroy(void* opaque) {
+    lottery* state = opaque;
+    free(state->entries);
+    free(state);
+}
+
+static void lottery_add_thread(void* opaque, const cpu_sim_thread_info* thread) {
+    lottery* state = opaque;
+
+    if (state->count == state->capacity) {
+        size_t capacity = (state->capacity == 0) ? 16 : 2 * state->capacity;
+        entry* entries = realloc(state->entries, capacity * sizeof(entry));
+        if (entries == NULL) {
+            abort();
+        }
+        state->entries = entries;
+        state->capacity = capacity;
+    }
+
+    int priority = (thread->priority >= 0 && thread->priority <= 3) ? thread->priority : 3;
+    state->entries[state->count].handle = thread->handle;
+    state->entries[state->count].tickets = TICKETS[priority];
+    state->total_tickets += TICKETS[priority];
+    state->count++;
+}
+
+static int lottery_pick_next(void* opaque, int current_time, cpu_sim_decision* decision) {
+    lottery* state = opaque;
+    if (state->count == 0) {
+        return 1;
+    }
+
+    long winner = (long) (next_random(state) % (uint64_t) state->total_tickets);
+    long ticket = winner;
+    size_t index = 0;
+    while (ticket >= state->entries[index].tickets) {
+        ticket -= state->entries[index].tickets;
+        index++;
+    }
+
+    decision->handle = state->entries[index].handle;
+    decision->time_slice = state->time_slice;
+    snprintf(decision->explanation, sizeof(decision->explanation),
+             "Drew ticket %ld of %ld from %zu threads. Will run for at most %d ticks.",
+             winner + 1, state->total_tickets, state->count, state->time_slice);
+
+    /* Keep the entries in arrival order so that draws do not depend on removal history. */
+    state->total_tickets -= state->entries[index].tickets;
+    for (size_t i = index + 1; i < state->count; i++) {
+        state->entries[i - 1] = state->entries[i];
+    }
+    state->count--;
+    return 0;
+}
+
+static const cpu_sim_scheduler_plugin LOTTERY_PLUGIN = {
+    CPU_SIM_PLUGIN_ABI_VERSION,
+    sizeof(cpu_sim_scheduler_plugin),
+    "lottery",
+    lottery_create,
+    lottery_destroy,
+    lottery_add_thread,
+    lottery_pick_next,
+    NULL,
+    NULL,
+};
+
+const cpu_sim_scheduler_plugin* cpu_sim_get_scheduler_plugin(void) {
+    return &LOTTERY_PLUGIN;
+}
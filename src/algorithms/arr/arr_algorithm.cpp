@@ -0,0 +1,156 @@
+#include "algorithms/arr/arr_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where the logic for the adaptive round robin algorithm is defined.
+*/
+
+ARRScheduler::ARRScheduler(int slice, double overhead_target) {
+    if (slice > 0) {
+        ARRScheduler::time_slice = slice;
+    } else {
+        ARRScheduler::time_slice = 3;
+    }
+
+    if (overhead_target <= 0.0 || overhead_target >= 1.0) {
+        throw("ARR overhead target must be between 0 and 1");
+    }
+    this->overhead_target = overhead_target;
+}
+
+int ARRScheduler::compute_quantum(int& burst_quantum, int& overhead_floor) const {
+    // Until a burst has been observed, the configured slice is the best guess.
+    burst_quantum = time_slice;
+    if (!recent_bursts.empty()) {
+        std::vector<int> sorted(recent_bursts.begin(), recent_bursts.end());
+        size_t rank = (size_t) std::ceil(burst_percentile * sorted.size());
+        rank = std::max((size_t) 1, rank) - 1;
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        burst_quantum = sorted[rank];
+    }
+
+    // Keep a full round of a long ready queue to about four quanta.
+    int quantum = burst_quantum;
+    if (ARRqueue.size() > 4) {
+        quantum = (int) (4 * (long) burst_quantum / ARRqueue.size());
+    }
+
+    // A dispatch of cost c per quantum q is a share c / (q + c) of the CPU time.
+    overhead_floor = 1;
+    if (dispatch_cost > 0) {
+        overhead_floor = (int) std::ceil(dispatch_cost * (1.0 - overhead_target) / overhead_target);
+    }
+
+    return std::max({quantum, overhead_floor, 1});
+}
+
+/*
+    explain_decision(sd):
+        Formats the explanation of an ARR decision, including where the quantum came from.
+        Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    return fmt::format("Selected from {} threads. Will run for at most {} ticks (burst quantum {}, overhead floor {}).",
+        sd.queue_sizes[0], sd.time_slice, sd.details[0], sd.details[1]);
+}
+
+SchedulingDecision ARRScheduler::get_next_thread() {
+    if (ARRqueue.empty()) {
+        return SchedulingDecision();
+    }
+
+    int burst_quantum, overhead_floor;
+    int quantum = compute_quantum(burst_quantum, overhead_floor);
+
+    if (quantum_history.empty() || quantum_history.back().second != quantum) {
+        quantum_history.emplace_back(current_time, quantum);
+    }
+
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = ARRqueue.size();
+    sd.thread = take_next(ARRqueue, sd.affinity_hit);
+    sd.time_slice = quantum;
+    sd.details[0] = burst_quantum;
+    sd.details[1] = overhead_floor;
+    sd.formatter = explain_decision;
+
+    // Track what this decision will cost to dispatch.
+    int cost = (sd.thread->process_id == affinity_process_id) ? thread_switch_overhead : process_switch_overhead;
+    dispatch_cost = (dispatch_cost < 0) ? cost : 0.9 * dispatch_cost + 0.1 * cost;
+    return sd;
+}
+
+void ARRScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    ARRqueue.push_back(thread);
+}
+
+void ARRScheduler::cpu_burst_completed(std::shared_ptr<Thread> thread, int length) {
+    recent_bursts.push_back(length);
+    if (recent_bursts.size() > burst_window) {
+        recent_bursts.pop_front();
+    }
+}
+
+std::shared_ptr<Thread> ARRScheduler::take_for_migration() {
+    // A thread that moves is not dispatched here, so it costs nothing and sets no quantum.
+    return ARRqueue.empty() ? nullptr : take_head(ARRqueue);
+}
+
+size_t ARRScheduler::size() const {
+    return ARRqueue.size();
+}
+
+std::string ARRScheduler::metrics_summary() const {
+    /*
+    This returns something like this:
+
+    ADAPTIVE QUANTUM:
+        Quantum changes:             41
+        Minimum quantum:              3
+        Maximum quantum:            105
+        Time-weighted average:    71.52
+        At time 0:                    3
+        At time 140:                 19
+        ...
+    */
+
+    if (quantum_history.empty()) {
+        return "";
+    }
+
+    int min_quantum = quantum_history.front().second;
+    int max_quantum = min_quantum;
+    double weighted_sum = 0.0;
+
+    for (size_t i = 0; i < quantum_history.size(); i++) {
+        int quantum = quantum_history[i].second;
+        min_quantum = std::min(min_quantum, quantum);
+        max_quantum = std::max(max_quantum, quantum);
+
+        int end = (i + 1 < quantum_history.size()) ? quantum_history[i + 1].first : current_time;
+        weighted_sum += (double) quantum * (end - quantum_history[i].first);
+    }
+
+    int span = current_time - quantum_history.front().first;
+    double average = (span > 0) ? weighted_sum / span : quantum_history.front().second;
+
+    std::string message = "ADAPTIVE QUANTUM:\n";
+    message += fmt::format("    {:<22} {:>8}\n", "Quantum changes:", quantum_history.size() - 1);
+    message += fmt::format("    {:<22} {:>8}\n", "Minimum quantum:", min_quantum);
+    message += fmt::format("    {:<22} {:>8}\n", "Maximum quantum:", max_quantum);
+    message += fmt::format("    {:<22} {:>8.{}f}\n", "Time-weighted average:", average, 2);
+
+    // Show at most 20 evenly spaced points of the history.
+    size_t step = std::max((size_t) 1, (quantum_history.size() + 19) / 20);
+    for (size_t i = 0; i < quantum_history.size(); i += step) {
+        message += fmt::format("    {:<22} {:>8}\n", fmt::format("At time {}:", quantum_history[i].first), quantum_history[i].second);
+    }
+    return message;
+}
@@ -0,0 +1,103 @@
+#ifndef ARR_ALGORITHM_HPP
+#define ARR_ALGORITHM_HPP
+
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/thread_list/thread_list.hpp"
+
+/*
+    ARRScheduler:
+        A representation of an adaptive-quantum round robin scheduling algorithm.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        Instead of a fixed time slice, the quantum is recomputed at every dispatch:
+            1. Start from a percentile (burst_percentile) of the last burst_window observed
+               CPU burst lengths, so that most bursts finish within one quantum.
+            2. Shrink it when more than four threads are ready, so a full round of the
+               ready queue takes about as long as four quanta.
+            3. Never go below the quantum at which dispatch overhead would exceed
+               overhead_target of the CPU time.
+*/
+
+class ARRScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        ARRqueue:
+            A queue of threads to be ran using a round robin algorithm.
+    */
+    ThreadList ARRqueue;
+
+    /*
+        overhead_target:
+            The largest share (between 0 and 1) of CPU time that dispatch overhead
+            should take.
+    */
+    double overhead_target;
+
+    /*
+        burst_window:
+            How many of the most recent CPU bursts are used to pick the quantum.
+    */
+    size_t burst_window = 32;
+
+    /*
+        burst_percentile:
+            Which percentile (between 0 and 1) of the recent CPU bursts is used as the quantum.
+    */
+    double burst_percentile = 0.8;
+
+    /*
+        recent_bursts:
+            The lengths of the most recent CPU bursts, oldest first.
+    */
+    std::deque<int> recent_bursts;
+
+    /*
+        dispatch_cost:
+            A running average of the dispatch overhead of this algorithm's decisions.
+    */
+    double dispatch_cost = -1;
+
+    /*
+        quantum_history:
+            Each time the quantum changed, and what it changed to.
+    */
+    std::vector<std::pair<int, int>> quantum_history;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    ARRScheduler(int slice = 3, double overhead_target = 0.25);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    void cpu_burst_completed(std::shared_ptr<Thread> thread, int length);
+
+    std::shared_ptr<Thread> take_for_migration();
+
+    size_t size() const;
+
+    std::string metrics_summary() const;
+
+    /*
+        compute_quantum(burst_quantum, overhead_floor):
+            Computes the quantum for the next dispatch from the recent bursts, the ready
+            queue length and the dispatch cost. Also returns the burst percentile and the
+            overhead floor it used, for the explanation.
+    */
+    int compute_quantum(int& burst_quantum, int& overhead_floor) const;
+};
+
+#endif
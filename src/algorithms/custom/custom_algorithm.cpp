@@ -13,12 +13,12 @@ CustomScheduler::CustomScheduler(int slice) {
     // TODO
 }
 
-std::shared_ptr<SchedulingDecision> CustomScheduler::get_next_thread() {
+SchedulingDecision CustomScheduler::get_next_thread() {
     // TODO
-    return nullptr;
+    return SchedulingDecision();
 }
 
-void CustomScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+void CustomScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
     // TODO
 }
 
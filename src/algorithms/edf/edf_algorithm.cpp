@@ -0,0 +1,63 @@
+#include "algorithms/edf/edf_algorithm.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where the logic for the earliest-deadline-first algorithm is defined.
+*/
+
+EDFScheduler::EDFScheduler(int slice, bool preemptive) {
+    if (slice != -1) {
+        throw("EDF must have a timeslice of -1");
+    }
+    this->preemptive = preemptive;
+}
+
+/*
+    explain_decision(sd):
+        Formats the explanation of an EDF decision. Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    if (sd.details[0] == -1) {
+        return fmt::format("Selected from {} threads. No thread has a deadline.", sd.queue_sizes[0]);
+    }
+    return fmt::format("Selected from {} threads. Earliest deadline is {}.", sd.queue_sizes[0], sd.details[0]);
+}
+
+SchedulingDecision EDFScheduler::get_next_thread() {
+    if (EDFheap.empty()) {
+        return SchedulingDecision();
+    }
+
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = EDFheap.size();
+    sd.thread = EDFheap.pop();
+    sd.time_slice = -1;
+    sd.details[0] = sd.thread->absolute_deadline;
+    sd.formatter = explain_decision;
+    return sd;
+}
+
+void EDFScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    EDFheap.push(thread);
+}
+
+bool EDFScheduler::should_preempt(std::shared_ptr<Thread> running) const {
+    if (!preemptive || running == nullptr || EDFheap.empty()) {
+        return false;
+    }
+
+    const auto& next = EDFheap.top();
+    if (next->absolute_deadline == -1) {
+        return false;
+    }
+    return running->absolute_deadline == -1 || next->absolute_deadline < running->absolute_deadline;
+}
+
+size_t EDFScheduler::size() const {
+    return EDFheap.size();
+}
@@ -0,0 +1,72 @@
+#ifndef EDF_ALGORITHM_HPP
+#define EDF_ALGORITHM_HPP
+
+#include <memory>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/thread_heap/thread_heap.hpp"
+
+/*
+    EarlierDeadline:
+        Orders threads by the absolute deadline of their current CPU burst. Threads
+        without a deadline go after all threads with one, and ties are broken by priority.
+*/
+
+struct EarlierDeadline {
+    bool operator()(const Thread& a, const Thread& b) const {
+        if (a.absolute_deadline != b.absolute_deadline) {
+            if (a.absolute_deadline == -1) return false;
+            if (b.absolute_deadline == -1) return true;
+            return a.absolute_deadline < b.absolute_deadline;
+        }
+        return a.priority < b.priority;
+    }
+};
+
+/*
+    EDFScheduler:
+        A representation of an earliest-deadline-first scheduling algorithm.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        The ready threads are kept in an indexed heap ordered by the deadline of their
+        current CPU burst (see Thread::release_next_burst).
+*/
+
+class EDFScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        EDFheap:
+            The ready threads, ordered by deadline.
+    */
+    ThreadHeap<EarlierDeadline> EDFheap;
+
+    /*
+        preemptive:
+            If true, a ready thread with an earlier deadline than the running thread
+            takes the CPU away from it immediately.
+    */
+    bool preemptive = false;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    EDFScheduler(int slice = -1, bool preemptive = false);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    bool should_preempt(std::shared_ptr<Thread> running) const;
+
+    bool is_preemptive() const { return preemptive; }
+
+    size_t size() const;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 #include <string>
@@ -20,28 +21,57 @@ FCFSScheduler::FCFSScheduler(int slice) {
     }
 }
 
-std::shared_ptr<SchedulingDecision> FCFSScheduler::get_next_thread() {
-    
-    if(!FCFSqueue.empty()){
-    
-    std::string message = "Selected from " + std::to_string(FCFSqueue.size()) + " threads. Will run to completion of burst.";
+/*
+    explain_decision(sd):
+        Formats the explanation of a FCFS decision. Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    std::string message = fmt::format("Selected from {} threads. Will run to completion of burst.", sd.queue_sizes[0]);
+
+    if (sd.affinity_hit) {
+        message += fmt::format(" Kept process {} on the CPU.", sd.thread->process_id);
+    }
+    return message;
+}
 
-    auto sd = std::make_shared<SchedulingDecision>();
-    sd->explanation = message;
-    sd->thread = FCFSqueue.front();
-    sd->time_slice = -1; 
+SchedulingDecision FCFSScheduler::get_next_thread() {
+    if (FCFSqueue.empty()) {
+        return SchedulingDecision();
+    }
 
-    FCFSqueue.pop();
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = FCFSqueue.size();
+    sd.thread = take_next(FCFSqueue, sd.affinity_hit);
+    sd.time_slice = -1;
+    sd.formatter = explain_decision;
     return sd;
-        
+}
+
+void FCFSScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    FCFSqueue.push_back(thread);
+}
+
+size_t FCFSScheduler::pick_up_to(size_t k, std::vector<SchedulingDecision>& out) {
+    // With affinity, each pick depends on the ones before it, so they are made one by one.
+    if (affinity_window > 0) {
+        return Scheduler::pick_up_to(k, out);
     }
 
+    size_t picked = std::min(k, FCFSqueue.size());
+    out.reserve(out.size() + picked);
 
-    return nullptr;
+    for (size_t i = 0; i < picked; i++) {
+        SchedulingDecision& sd = out.emplace_back();
+        sd.queue_sizes[0] = FCFSqueue.size();
+        sd.thread = take_head(FCFSqueue);
+        sd.time_slice = -1;
+        sd.formatter = explain_decision;
+    }
+    return picked;
 }
 
-void FCFSScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
-    FCFSqueue.push(thread);
+std::shared_ptr<Thread> FCFSScheduler::take_for_migration() {
+    return FCFSqueue.empty() ? nullptr : take_head(FCFSqueue);
 }
 
 size_t FCFSScheduler::size() const {
@@ -2,8 +2,8 @@
 #define FCFS_ALGORITHM_HPP
 
 #include <memory>
-#include <queue>
 #include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/thread_list/thread_list.hpp"
 
 /*
     FCFSScheduler:
@@ -27,7 +27,7 @@ public:
         FCFSqueue:
             A queue of threads to be ran using a FCFS algorithm
     */
-    std::queue<std::shared_ptr<Thread>> FCFSqueue;
+    ThreadList FCFSqueue;
 
 
 
@@ -37,9 +37,13 @@ public:
 
     FCFSScheduler(int slice = -1);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    SchedulingDecision get_next_thread();
 
-    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    size_t pick_up_to(size_t k, std::vector<SchedulingDecision>& out);
+
+    std::shared_ptr<Thread> take_for_migration();
 
     size_t size() const;
 
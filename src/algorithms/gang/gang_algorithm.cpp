@@ -0,0 +1,130 @@
+#include "algorithms/gang/gang_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where the logic for the gang scheduling algorithm is defined.
+*/
+
+GANGScheduler::GANGScheduler(int slice, int process_quantum) {
+    if (slice > 0) {
+        GANGScheduler::time_slice = slice;
+    } else {
+        GANGScheduler::time_slice = 3;
+    }
+
+    // By default a process gets enough time to run four slices per turn.
+    if (process_quantum > 0) {
+        this->process_quantum = process_quantum;
+    } else {
+        this->process_quantum = 4 * GANGScheduler::time_slice;
+    }
+}
+
+/*
+    explain_decision(sd):
+        Formats the explanation of a gang decision. Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    return fmt::format("Selected from {} threads of process {} ({} ready in total). Will run for at most {} ticks, {} ticks of quantum left.",
+        sd.queue_sizes[0], sd.source, sd.details[0], sd.time_slice, sd.details[1]);
+}
+
+SchedulingDecision GANGScheduler::get_next_thread() {
+    if (thread_count == 0) {
+        return SchedulingDecision();
+    }
+
+    // Move on to the next process once the current one has used its quantum or has no ready threads.
+    if (current_process == -1 || quantum_left <= 0 || process_queues[current_process].empty()) {
+        if (current_process != -1 && !process_queues[current_process].empty()) {
+            process_order.push_back(current_process);
+        }
+
+        current_process = process_order.front();
+        process_order.pop_front();
+        quantum_left = process_quantum;
+        turns[current_process]++;
+    }
+
+    auto& queue = process_queues[current_process];
+
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = queue.size();
+    sd.details[0] = thread_count;
+    sd.source = current_process;
+    sd.thread = queue.pop_front();
+    sd.time_slice = std::min(time_slice, quantum_left);
+    thread_count--;
+
+    // The thread runs for the slice or until its burst ends, whichever comes first.
+    int used = std::min(sd.time_slice, sd.thread->get_next_burst(CPU)->length);
+    quantum_left -= used;
+    quantum_used[current_process] += used;
+
+    sd.details[1] = quantum_left;
+    sd.formatter = explain_decision;
+    return sd;
+}
+
+void GANGScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    auto& queue = process_queues[thread->process_id];
+
+    if (queue.empty() && thread->process_id != current_process) {
+        process_order.push_back(thread->process_id);
+    }
+
+    queue.push_back(thread);
+    thread_count++;
+}
+
+std::shared_ptr<Thread> GANGScheduler::take_for_migration() {
+    if (thread_count == 0) {
+        return nullptr;
+    }
+
+    int process_id = current_process;
+    if (process_id == -1 || process_queues[process_id].empty()) {
+        process_id = process_order.front();
+    }
+
+    // A waiting process that has no ready threads left gives up its place in line.
+    auto& queue = process_queues[process_id];
+    std::shared_ptr<Thread> thread = queue.pop_front();
+    if (queue.empty() && process_id != current_process) {
+        process_order.erase(std::find(process_order.begin(), process_order.end(), process_id));
+    }
+    thread_count--;
+    return thread;
+}
+
+size_t GANGScheduler::size() const {
+    return thread_count;
+}
+
+std::string GANGScheduler::metrics_summary() const {
+    /*
+    This returns something like this:
+
+    GANG QUANTUM USAGE:
+        Process 642:    TURNS: 31     USED: 403    AVG: 13.00
+        Process 740:    TURNS: 19     USED: 225    AVG: 11.84
+    */
+
+    std::string message = "GANG QUANTUM USAGE:\n";
+
+    for (auto entry : turns) {
+        long used = quantum_used.at(entry.first);
+
+        message += fmt::format("    Process {:>3}:    ", entry.first);
+        message += fmt::format("TURNS: {:<6} ", entry.second);
+        message += fmt::format("USED: {:<6} ", used);
+        message += fmt::format("AVG: {:<6.2f}\n", (double) used / entry.second);
+    }
+    return message;
+}
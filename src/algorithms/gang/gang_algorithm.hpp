@@ -0,0 +1,101 @@
+#ifndef GANG_ALGORITHM_HPP
+#define GANG_ALGORITHM_HPP
+
+#include <deque>
+#include <map>
+#include <memory>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/thread_list/thread_list.hpp"
+
+/*
+    GANGScheduler:
+        A representation of a gang scheduling algorithm.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        Ready threads are grouped by process. Processes take turns in round robin order,
+        and during its turn a process runs its ready threads back-to-back (each for at
+        most time_slice ticks) until it has used its process quantum or has no more
+        ready threads. Consecutive threads of the same process only pay the thread
+        switch overhead.
+*/
+
+class GANGScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        process_queues:
+            The ready threads of each process, in the order they became ready.
+    */
+    std::map<int, ThreadList> process_queues;
+
+    /*
+        process_order:
+            The processes that have ready threads and are waiting for their turn, in
+            round robin order. The current process is not in it.
+    */
+    std::deque<int> process_order;
+
+    /*
+        current_process:
+            The process whose turn it is, or -1 before the first turn.
+    */
+    int current_process = -1;
+
+    /*
+        process_quantum:
+            How much CPU time a process gets per turn.
+    */
+    int process_quantum;
+
+    /*
+        quantum_left:
+            How much of the current process's quantum is left.
+    */
+    int quantum_left = 0;
+
+    /*
+        quantum_used:
+            The total CPU time each process has been given during its turns.
+    */
+    std::map<int, long> quantum_used;
+
+    /*
+        turns:
+            The number of turns each process has had.
+    */
+    std::map<int, long> turns;
+
+    /*
+        thread_count:
+            The total number of ready threads.
+    */
+    size_t thread_count = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    GANGScheduler(int slice = 3, int process_quantum = -1);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    /*
+        take_for_migration():
+            Takes a thread of the current process, or else of the next one in line, without
+            starting a turn or using any quantum.
+    */
+    std::shared_ptr<Thread> take_for_migration();
+
+    size_t size() const;
+
+    std::string metrics_summary() const;
+};
+
+#endif
@@ -0,0 +1,206 @@
+#include "algorithms/hfs/hfs_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where the logic for the hierarchical fair-share algorithm is defined.
+*/
+
+/*
+    explain_decision(sd):
+        Formats the explanation of a fair-share decision. Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    std::string message = fmt::format("Selected from {} threads of group {} ({} ready in total). Will run for at most {} ticks",
+        sd.queue_sizes[1], sd.label, sd.queue_sizes[0], sd.time_slice);
+
+    if (sd.details[0] >= 0) {
+        message += fmt::format(", {} ticks of quota left.", sd.details[0]);
+    } else {
+        message += ".";
+    }
+    return message;
+}
+
+HFSScheduler::HFSScheduler(int slice) {
+    if (slice > 0) {
+        HFSScheduler::time_slice = slice;
+    } else {
+        HFSScheduler::time_slice = 3;
+    }
+
+    groups.emplace_back(Group("default", 1024, -1, 100));
+}
+
+SchedulingDecision HFSScheduler::get_next_thread() {
+    release_throttled(current_time);
+
+    if (runnable_groups.empty()) {
+        return SchedulingDecision();
+    }
+
+    int index = runnable_groups.begin()->second;
+    runnable_groups.erase(runnable_groups.begin());
+
+    FairGroup& group = groups[index];
+    group_clock = std::max(group_clock, group.virtual_runtime);
+    start_period(group, current_time);
+
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = ready_count;
+    sd.queue_sizes[1] = group.threads.size();
+    sd.source = index;
+    sd.label = group.config.name.c_str();
+
+    sd.thread = group.threads.pop();
+    ready_count--;
+    group.wait_times.push_back(current_time - sd.thread->state_change_time);
+
+    // A group may not run past its quota, so the slice is cut to what is left of it.
+    int slice = time_slice;
+    if (group.config.quota > 0) {
+        slice = std::min(slice, group.config.quota - group.used_in_period);
+    }
+    sd.time_slice = slice;
+
+    // The thread runs for the slice or until its burst ends, whichever comes first.
+    int used = std::min(slice, sd.thread->get_next_burst(CPU)->length);
+    group.thread_clock = std::max(group.thread_clock, sd.thread->virtual_runtime);
+    sd.thread->virtual_runtime += used;
+    group.virtual_runtime += used * 1024.0 / group.config.shares;
+    group.used_in_period += used;
+    group.cpu_time += used;
+
+    sd.details[0] = -1;
+    if (group.config.quota > 0) {
+        sd.details[0] = group.config.quota - group.used_in_period;
+    }
+
+    if (group.config.quota > 0 && group.used_in_period >= group.config.quota) {
+        // Park the group until its period ends. It is throttled from the moment this run ends.
+        int release_time = group.period_start + group.config.period;
+        group.throttled = true;
+        group.throttle_count++;
+        group.throttled_time += std::max(0, release_time - (current_time + used));
+        throttled_groups.emplace(release_time, index);
+    } else if (!group.threads.empty()) {
+        runnable_groups.emplace(group.virtual_runtime, index);
+    }
+
+    sd.formatter = explain_decision;
+    return sd;
+}
+
+void HFSScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    int index = group_index(thread->process_id);
+    FairGroup& group = groups[index];
+
+    thread->virtual_runtime = std::max(thread->virtual_runtime, group.thread_clock);
+
+    bool was_idle = group.threads.empty();
+    group.threads.push(thread);
+    ready_count++;
+
+    if (was_idle && !group.throttled) {
+        group.virtual_runtime = std::max(group.virtual_runtime, group_clock);
+        runnable_groups.emplace(group.virtual_runtime, index);
+    }
+}
+
+void HFSScheduler::add_group(const Group& group) {
+    groups.emplace_back(group);
+    for (int process_id : group.process_ids) {
+        group_of_process[process_id] = groups.size() - 1;
+    }
+}
+
+int HFSScheduler::next_wakeup_time() const {
+    // Only wake up if there are ready threads and all of them are in throttled groups.
+    if (ready_count == 0 || !runnable_groups.empty() || throttled_groups.empty()) {
+        return -1;
+    }
+    return throttled_groups.top().first;
+}
+
+size_t HFSScheduler::size() const {
+    return ready_count;
+}
+
+int HFSScheduler::group_index(int process_id) {
+    auto found = group_of_process.find(process_id);
+    return (found != group_of_process.end()) ? found->second : 0;
+}
+
+void HFSScheduler::start_period(FairGroup& group, int time) {
+    int period = group.config.period;
+    if (time >= group.period_start + period) {
+        group.period_start = time - time % period;
+        group.used_in_period = 0;
+    }
+}
+
+void HFSScheduler::release_throttled(int time) {
+    while (!throttled_groups.empty() && throttled_groups.top().first <= time) {
+        int index = throttled_groups.top().second;
+        throttled_groups.pop();
+
+        FairGroup& group = groups[index];
+        group.throttled = false;
+        start_period(group, time);
+
+        if (!group.threads.empty()) {
+            group.virtual_runtime = std::max(group.virtual_runtime, group_clock);
+            runnable_groups.emplace(group.virtual_runtime, index);
+        }
+    }
+}
+
+std::string HFSScheduler::metrics_summary() const {
+    /*
+    This returns something like this:
+
+    FAIR SHARE GROUPS:
+        Group web:       SHARES: 2048   QUOTA: 40/100     CPU: 612    THROTTLED: 1830   (31 times)
+                         WAIT P50: 6      P90: 45     P99: 118    MAX: 131
+    */
+
+    std::string message = "FAIR SHARE GROUPS:\n";
+
+    for (const auto& group : groups) {
+        // The default group is only shown if some process was in it.
+        if (group.wait_times.empty() && &group == &groups.front()) {
+            continue;
+        }
+
+        std::string quota = "none";
+        if (group.config.quota > 0) {
+            quota = fmt::format("{}/{}", group.config.quota, group.config.period);
+        }
+
+        message += fmt::format("    Group {:<10} ", group.config.name + ":");
+        message += fmt::format("SHARES: {:<6} ", group.config.shares);
+        message += fmt::format("QUOTA: {:<10} ", quota);
+        message += fmt::format("CPU: {:<6} ", group.cpu_time);
+        message += fmt::format("THROTTLED: {:<6} ({} times)\n", group.throttled_time, group.throttle_count);
+
+        // Nearest-rank percentiles of the time threads waited before being dispatched.
+        std::vector<int> sorted = group.wait_times;
+        std::sort(sorted.begin(), sorted.end());
+        const double ranks[4] = {0.50, 0.90, 0.99, 1.00};
+        int percentiles[4] = {0, 0, 0, 0};
+        for (int i = 0; i < 4 && !sorted.empty(); i++) {
+            size_t rank = (size_t) std::ceil(ranks[i] * sorted.size());
+            percentiles[i] = sorted[std::max((size_t) 1, rank) - 1];
+        }
+
+        message += fmt::format("{:<21}", "");
+        message += fmt::format("WAIT P50: {:<6} P90: {:<6} P99: {:<6} MAX: {:<6}\n", percentiles[0], percentiles[1], percentiles[2], percentiles[3]);
+    }
+    return message;
+}
@@ -0,0 +1,192 @@
+#ifndef HFS_ALGORITHM_HPP
+#define HFS_ALGORITHM_HPP
+
+#include <functional>
+#include <memory>
+#include <queue>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "types/group/group.hpp"
+#include "utilities/thread_heap/thread_heap.hpp"
+
+/*
+    LessVirtualRuntime:
+        Orders threads by the CPU time they have been charged, so the thread that is
+        furthest behind runs first.
+*/
+
+struct LessVirtualRuntime {
+    bool operator()(const Thread& a, const Thread& b) const {
+        return a.virtual_runtime < b.virtual_runtime;
+    }
+};
+
+/*
+    HFSScheduler:
+        A representation of a hierarchical fair-share scheduling algorithm with CPU quotas.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        Processes belong to groups (see the Group class). The scheduler first picks the
+        group that has received the least CPU time relative to its shares, then the thread
+        of that group that has received the least CPU time, and runs it for at most one
+        time slice. A group with a quota that uses it up is throttled until its period ends.
+        Throttled groups are parked in a heap ordered by the end of their period, so they
+        are never scanned while they cannot run.
+
+        CPU time is charged when a thread is dispatched, for the length it will run (the
+        slice or the rest of its burst), and counts against the period it was dispatched in.
+        Processes that are not in any group share a "default" group with 1024 shares and
+        no quota, which is always the first group.
+
+        Several CPUs share one HFSScheduler, so a group's quota is for all of them together.
+        It cannot be used with per-CPU ready queues (--balance), since each queue would have
+        its own scheduler and give the group its quota again.
+*/
+
+class HFSScheduler : public Scheduler {
+public:
+
+    /*
+        FairGroup:
+            The scheduling state of one group.
+    */
+    struct FairGroup {
+        Group config;
+
+        /*
+            threads:
+                The group's ready threads, ordered by virtual runtime.
+        */
+        ThreadHeap<LessVirtualRuntime> threads;
+
+        /*
+            virtual_runtime:
+                The CPU time the group has been charged, scaled by 1024 / shares.
+        */
+        double virtual_runtime = 0.0;
+
+        /*
+            thread_clock:
+                The virtual runtime of the last thread picked from the group. A thread that
+                becomes ready starts no further behind than this, so it cannot make up for
+                the time it spent blocked.
+        */
+        long thread_clock = 0;
+
+        /*
+            period_start, used_in_period:
+                When the current quota period started and how much CPU time the group has
+                been charged in it.
+        */
+        int period_start = 0;
+        int used_in_period = 0;
+
+        /*
+            throttled:
+                True while the group has used up its quota and is parked.
+        */
+        bool throttled = false;
+
+        /*
+            cpu_time, throttle_count, throttled_time:
+                The CPU time the group was given, how many times it was throttled, and the
+                total time it spent throttled.
+        */
+        long cpu_time = 0;
+        long throttle_count = 0;
+        long throttled_time = 0;
+
+        /*
+            wait_times:
+                How long each dispatched thread of the group waited in the ready queue.
+        */
+        std::vector<int> wait_times;
+
+        FairGroup(const Group& config): config(config) {}
+    };
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        groups:
+            Every group, in the order they were added.
+    */
+    std::vector<FairGroup> groups;
+
+    /*
+        group_of_process:
+            The index in groups of each process's group.
+    */
+    std::unordered_map<int, int> group_of_process;
+
+    /*
+        runnable_groups:
+            The groups that have ready threads and are not throttled, ordered by
+            (virtual runtime, index).
+    */
+    std::set<std::pair<double, int>> runnable_groups;
+
+    /*
+        throttled_groups:
+            The throttled groups, ordered by the time they can run again.
+    */
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> throttled_groups;
+
+    /*
+        group_clock:
+            The virtual runtime of the last group picked. A group whose threads become
+            ready again starts no further behind than this.
+    */
+    double group_clock = 0.0;
+
+    /*
+        ready_count:
+            The total number of ready threads, including those of throttled groups.
+    */
+    size_t ready_count = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    HFSScheduler(int slice = 3);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    void add_group(const Group& group);
+
+    int next_wakeup_time() const;
+
+    size_t size() const;
+
+    std::string metrics_summary() const;
+
+    /*
+        group_index(process_id):
+            Returns the index of the process's group.
+    */
+    int group_index(int process_id);
+
+    /*
+        start_period(group, time):
+            Starts a new quota period for the group if its current one has ended by time.
+    */
+    void start_period(FairGroup& group, int time);
+
+    /*
+        release_throttled(time):
+            Unparks the groups whose period has ended by time.
+    */
+    void release_throttled(int time);
+};
+
+#endif
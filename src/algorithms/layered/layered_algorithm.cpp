@@ -0,0 +1,77 @@
+#include "algorithms/layered/layered_algorithm.hpp"
+
+#include <algorithm>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where the parts of the layered algorithms that do not depend on the policies
+    are defined.
+*/
+
+/*
+    LEVEL_NAMES:
+        The names of the priority levels, indexed by ProcessPriority.
+*/
+static const char* LEVEL_NAMES[4] = {"SYSTEM", "INTERACTIVE", "NORMAL", "BATCH"};
+
+std::string explain_layered_decision(const SchedulingDecision& sd) {
+    std::string message = fmt::format("Selected from the {} queue ({} of {} ready threads). ",
+        sd.label, sd.queue_sizes[1], sd.queue_sizes[0]);
+
+    if (sd.time_slice > 0) {
+        message += fmt::format("Will run for at most {} ticks.", sd.time_slice);
+    } else {
+        message += "Will run to completion of burst.";
+    }
+    return message;
+}
+
+//==================================================
+//  PriorityLevels
+//==================================================
+
+const char* PriorityLevels::label(size_t bucket) const {
+    return LEVEL_NAMES[bucket];
+}
+
+//==================================================
+//  Tenants
+//==================================================
+
+size_t Tenants::bucket_of(const Thread& thread) const {
+    auto found = tenant_of_process.find(thread.process_id);
+    return (found != tenant_of_process.end()) ? found->second : 0;
+}
+
+void Tenants::add_group(const Group& group) {
+    tenants.push_back(Tenant{group.name, group.shares, 0.0});
+    for (int process_id : group.process_ids) {
+        tenant_of_process[process_id] = tenants.size() - 1;
+    }
+}
+
+void Tenants::on_ready(size_t bucket) {
+    Tenant& tenant = tenants[bucket];
+    tenant.virtual_runtime = std::max(tenant.virtual_runtime, clock);
+    runnable.emplace(tenant.virtual_runtime, bucket);
+}
+
+int Tenants::pick() {
+    if (runnable.empty()) {
+        return -1;
+    }
+    size_t bucket = runnable.begin()->second;
+    runnable.erase(runnable.begin());
+    clock = std::max(clock, tenants[bucket].virtual_runtime);
+    return bucket;
+}
+
+void Tenants::charge(size_t bucket, int used, bool still_ready) {
+    Tenant& tenant = tenants[bucket];
+    tenant.virtual_runtime += used * 1024.0 / tenant.shares;
+    if (still_ready) {
+        runnable.emplace(tenant.virtual_runtime, bucket);
+    }
+}
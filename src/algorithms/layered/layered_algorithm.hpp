@@ -0,0 +1,135 @@
+#ifndef LAYERED_ALGORITHM_HPP
+#define LAYERED_ALGORITHM_HPP
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "algorithms/layered/layered_policies.hpp"
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    explain_layered_decision(sd):
+        Formats the explanation of a decision made by any Layered scheduler. Only called
+        when it is printed.
+*/
+std::string explain_layered_decision(const SchedulingDecision& sd);
+
+/*
+    Layered<Outer, Inner>:
+        A scheduling algorithm composed from two policies (see layered_policies.hpp). The
+        Outer policy splits the ready threads into buckets and picks the bucket to serve;
+        each bucket orders its own threads with an Inner policy. For example,
+        Layered<PriorityLevels, Fifo> is equivalent to the PRIORITY algorithm, and
+        Layered<PriorityLevels, RoundRobin> is round robin within each priority level.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        The policies are plain members rather than pointers to a base class, and the class
+        is final, so every call into them is resolved at compile time and can be inlined.
+
+        CPU time is charged when a thread is dispatched, for the length it will run (the
+        slice or the rest of its burst).
+*/
+
+template <typename Outer, typename Inner>
+class Layered final : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    Outer outer;
+
+    /*
+        buckets:
+            The ready threads of each of the outer policy's buckets.
+    */
+    std::vector<Inner> buckets;
+
+    /*
+        ready_count:
+            The total number of ready threads.
+    */
+    size_t ready_count = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    Layered(int slice = 3) {
+        time_slice = (slice > 0) ? slice : 3;
+        buckets.resize(outer.size());
+    }
+
+    SchedulingDecision get_next_thread() {
+        int bucket = outer.pick();
+        if (bucket < 0) {
+            return SchedulingDecision();
+        }
+        Inner& threads = buckets[bucket];
+
+        SchedulingDecision sd;
+        sd.queue_sizes[0] = ready_count;
+        sd.queue_sizes[1] = threads.size();
+        sd.source = bucket;
+        sd.label = outer.label(bucket);
+
+        sd.thread = threads.pop();
+        ready_count--;
+        sd.time_slice = threads.slice(time_slice);
+
+        // The thread runs for the slice or until its burst ends, whichever comes first.
+        int used = sd.thread->get_next_burst(CPU)->length;
+        if (sd.time_slice > 0) {
+            used = std::min(used, sd.time_slice);
+        }
+        threads.charge(*sd.thread, used);
+        outer.charge(bucket, used, !threads.empty());
+
+        sd.formatter = explain_layered_decision;
+        return sd;
+    }
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+        size_t bucket = outer.bucket_of(*thread);
+        Inner& threads = buckets[bucket];
+
+        bool was_idle = threads.empty();
+        threads.push(thread);
+        ready_count++;
+
+        if (was_idle) {
+            outer.on_ready(bucket);
+        }
+    }
+
+    /*
+        take_for_migration():
+            Takes the thread get_next_thread() would pick, without charging it or its bucket.
+    */
+    std::shared_ptr<Thread> take_for_migration() {
+        int bucket = outer.pick();
+        if (bucket < 0) {
+            return nullptr;
+        }
+        Inner& threads = buckets[bucket];
+
+        std::shared_ptr<Thread> thread = threads.pop();
+        ready_count--;
+        outer.charge(bucket, 0, !threads.empty());
+        return thread;
+    }
+
+    void add_group(const Group& group) {
+        outer.add_group(group);
+        buckets.resize(outer.size());
+    }
+
+    size_t size() const {
+        return ready_count;
+    }
+};
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef LAYERED_POLICIES_HPP
+#define LAYERED_POLICIES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "algorithms/hfs/hfs_algorithm.hpp"
+#include "types/group/group.hpp"
+#include "types/thread/thread.hpp"
+#include "utilities/thread_heap/thread_heap.hpp"
+#include "utilities/thread_list/thread_list.hpp"
+
+/*
+    The policies that Layered<Outer, Inner> (see layered_algorithm.hpp) is built from.
+
+    An outer policy splits the ready threads into buckets (priority levels, groups, ...) and
+    decides which bucket to serve next. It provides:
+
+        size_t size() const                      the number of buckets
+        size_t bucket_of(const Thread& thread)   the bucket a ready thread goes into
+        void add_group(const Group& group)       a group from the simulation file
+        void on_ready(size_t bucket)             the bucket was empty and has a thread now
+        int pick()                               takes the bucket to serve, or -1 if none
+        void charge(size_t bucket, int used, bool still_ready)
+                                                 the picked bucket's thread will run for used
+                                                 ticks; puts it back if it has threads left
+        const char* label(size_t bucket) const   the bucket's name, for explanations
+
+    An inner policy orders the threads of one bucket. It provides:
+
+        void push(const std::shared_ptr<Thread>& thread)
+        std::shared_ptr<Thread> pop()
+        int slice(int time_slice) const          the slice to run for, or -1 for the whole burst
+        void charge(Thread& thread, int used)    the popped thread will run for used ticks
+        size_t size() const
+        bool empty() const
+
+    None of these are virtual, so the compiler sees the whole composition as one type.
+*/
+
+//==================================================
+//  Outer policies
+//==================================================
+
+/*
+    PriorityLevels:
+        One bucket per process priority. The highest non-empty level is always served first.
+*/
+
+class PriorityLevels {
+public:
+
+    /*
+        ready_levels:
+            A bit for each level that has ready threads and has not been picked.
+    */
+    unsigned ready_levels = 0;
+
+    size_t size() const { return 4; }
+
+    size_t bucket_of(const Thread& thread) const { return thread.priority; }
+
+    void add_group(const Group& group) {}
+
+    void on_ready(size_t bucket) { ready_levels |= 1u << bucket; }
+
+    int pick() {
+        if (ready_levels == 0) {
+            return -1;
+        }
+        int level = __builtin_ctz(ready_levels);
+        ready_levels &= ~(1u << level);
+        return level;
+    }
+
+    void charge(size_t bucket, int used, bool still_ready) {
+        if (still_ready) {
+            on_ready(bucket);
+        }
+    }
+
+    const char* label(size_t bucket) const;
+};
+
+/*
+    Tenants:
+        One bucket per group in the simulation file, plus a "default" bucket for processes
+        that are in no group. The group that has received the least CPU time relative to its
+        shares is served first, as with HFS. Quotas are ignored; use HFS to enforce them.
+*/
+
+class Tenants {
+public:
+
+    /*
+        Tenant:
+            The scheduling state of one group.
+    */
+    struct Tenant {
+        std::string name;
+        int shares = 1024;
+
+        /*
+            virtual_runtime:
+                The CPU time the group has been charged, scaled by 1024 / shares.
+        */
+        double virtual_runtime = 0.0;
+    };
+
+    /*
+        tenants:
+            Every group, in the order they were added. The default group is the first.
+    */
+    std::vector<Tenant> tenants = {Tenant{"default", 1024, 0.0}};
+
+    /*
+        tenant_of_process:
+            The index in tenants of each process's group.
+    */
+    std::unordered_map<int, size_t> tenant_of_process;
+
+    /*
+        runnable:
+            The groups that have ready threads and have not been picked, ordered by
+            (virtual runtime, index).
+    */
+    std::set<std::pair<double, size_t>> runnable;
+
+    /*
+        clock:
+            The virtual runtime of the last group picked. A group whose threads become ready
+            again starts no further behind than this.
+    */
+    double clock = 0.0;
+
+    size_t size() const { return tenants.size(); }
+
+    size_t bucket_of(const Thread& thread) const;
+
+    void add_group(const Group& group);
+
+    void on_ready(size_t bucket);
+
+    int pick();
+
+    void charge(size_t bucket, int used, bool still_ready);
+
+    const char* label(size_t bucket) const { return tenants[bucket].name.c_str(); }
+};
+
+//==================================================
+//  Inner policies
+//==================================================
+
+/*
+    Fifo:
+        Threads run in the order they became ready, each until its burst ends.
+*/
+
+class Fifo {
+public:
+
+    ThreadList queue;
+
+    void push(const std::shared_ptr<Thread>& thread) { queue.push_back(thread); }
+
+    std::shared_ptr<Thread> pop() { return queue.pop_front(); }
+
+    int slice(int time_slice) const { return -1; }
+
+    void charge(Thread& thread, int used) {}
+
+    size_t size() const { return queue.size(); }
+
+    bool empty() const { return queue.empty(); }
+};
+
+/*
+    RoundRobin:
+        Threads run in the order they became ready, each for at most one time slice.
+*/
+
+class RoundRobin : public Fifo {
+public:
+
+    int slice(int time_slice) const { return time_slice; }
+};
+
+/*
+    FairShare:
+        The thread that has received the least CPU time runs next, for at most one time
+        slice, like the threads of an HFS group.
+*/
+
+class FairShare {
+public:
+
+    ThreadHeap<LessVirtualRuntime> threads;
+
+    /*
+        clock:
+            The virtual runtime of the last thread popped. A thread that becomes ready starts
+            no further behind than this, so it cannot make up for the time it spent blocked.
+    */
+    long clock = 0;
+
+    void push(const std::shared_ptr<Thread>& thread) {
+        thread->virtual_runtime = std::max(thread->virtual_runtime, clock);
+        threads.push(thread);
+    }
+
+    std::shared_ptr<Thread> pop() {
+        std::shared_ptr<Thread> thread = threads.pop();
+        clock = std::max(clock, thread->virtual_runtime);
+        return thread;
+    }
+
+    int slice(int time_slice) const { return time_slice; }
+
+    void charge(Thread& thread, int used) { thread.virtual_runtime += used; }
+
+    size_t size() const { return threads.size(); }
+
+    bool empty() const { return threads.empty(); }
+};
+
+#endif
@@ -14,12 +14,12 @@ MFLQScheduler::MFLQScheduler(int slice) {
     // TODO
 }
 
-std::shared_ptr<SchedulingDecision> MFLQScheduler::get_next_thread() {
+SchedulingDecision MFLQScheduler::get_next_thread() {
     // TODO
-    return nullptr;
+    return SchedulingDecision();
 }
 
-void MFLQScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+void MFLQScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
     // TODO
 }
 
@@ -28,9 +28,9 @@ public:
 
     MFLQScheduler(int slice = -1);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    SchedulingDecision get_next_thread();
 
-    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
 
     size_t size() const;
 
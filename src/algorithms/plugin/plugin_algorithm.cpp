@@ -0,0 +1,178 @@
+#include "algorithms/plugin/plugin_algorithm.hpp"
+
+#include <dlfcn.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where the glue between the simulator and a scheduler plugin is defined.
+*/
+
+/*
+    VERSION_1_SIZE:
+        The size of the function table in the first release of ABI version 1. Members
+        appended later must be checked against struct_size before they are used.
+*/
+static const size_t VERSION_1_SIZE = offsetof(cpu_sim_scheduler_plugin, should_preempt) + sizeof(cpu_sim_scheduler_plugin::should_preempt);
+
+/*
+    explain_decision(sd):
+        Formats an explanation for a decision the plugin did not explain itself.
+        Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    if (sd.time_slice == -1) {
+        return fmt::format("Selected from {} threads. Will run to completion of burst.", sd.queue_sizes[0]);
+    }
+    return fmt::format("Selected from {} threads. Will run for at most {} ticks.", sd.queue_sizes[0], sd.time_slice);
+}
+
+PluginScheduler::PluginScheduler(const std::string& path, int slice) {
+    this->path = path;
+    this->time_slice = slice;
+
+    library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (library == nullptr) {
+        std::cerr << "Unable to load scheduler plugin: " << dlerror() << std::endl;
+        throw(std::logic_error("Bad plugin."));
+    }
+
+    auto entry = (cpu_sim_plugin_entry_fn) dlsym(library, CPU_SIM_PLUGIN_ENTRY);
+    if (entry != nullptr) {
+        plugin = entry();
+    }
+
+    if (plugin == nullptr) {
+        std::cerr << "Scheduler plugin " << path << " does not export " << CPU_SIM_PLUGIN_ENTRY << "()" << std::endl;
+    } else if (plugin->abi_version != CPU_SIM_PLUGIN_ABI_VERSION) {
+        std::cerr << "Scheduler plugin " << path << " was built for ABI version " << plugin->abi_version
+                  << ", but this simulator uses version " << CPU_SIM_PLUGIN_ABI_VERSION << std::endl;
+    } else if (plugin->struct_size < VERSION_1_SIZE || plugin->name == nullptr
+               || plugin->create == nullptr || plugin->destroy == nullptr || plugin->add_thread == nullptr || plugin->pick_next == nullptr) {
+        std::cerr << "Scheduler plugin " << path << " is missing a required function" << std::endl;
+    } else {
+        state = plugin->create(slice);
+        if (state == nullptr) {
+            std::cerr << "Scheduler plugin " << path << " failed to start" << std::endl;
+        }
+    }
+
+    if (state == nullptr) {
+        dlclose(library);
+        throw(std::logic_error("Bad plugin."));
+    }
+}
+
+SchedulingDecision PluginScheduler::get_next_thread() {
+    if (ready_threads.empty()) {
+        return SchedulingDecision();
+    }
+
+    cpu_sim_decision decision = {};
+    decision.time_slice = -1;
+    if (plugin->pick_next(state, current_time, &decision) != 0) {
+        std::cerr << "Scheduler plugin " << plugin->name << " failed to pick a thread" << std::endl;
+        throw(std::logic_error("Bad plugin decision."));
+    }
+
+    // Only accept a thread that is actually waiting, so a buggy plugin cannot run a thread twice.
+    Thread* thread = (Thread*) (uintptr_t) decision.handle;
+    auto found = ready_threads.find(thread);
+    if (found == ready_threads.end()) {
+        std::cerr << "Scheduler plugin " << plugin->name << " picked a thread that is not ready" << std::endl;
+        throw(std::logic_error("Bad plugin decision."));
+    }
+
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = ready_threads.size();
+    ready_threads.erase(found);
+    decisions++;
+
+    sd.thread = thread->shared_from_this();
+    sd.time_slice = decision.time_slice > 0 ? decision.time_slice : -1;
+
+    decision.explanation[CPU_SIM_PLUGIN_EXPLANATION_SIZE - 1] = '\0';
+    if (decision.explanation[0] != '\0') {
+        sd.explanation = decision.explanation;
+    } else {
+        sd.formatter = explain_decision;
+    }
+    return sd;
+}
+
+void PluginScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    ready_threads.insert(thread.get());
+
+    cpu_sim_thread_info info = thread_info(*thread);
+    plugin->add_thread(state, &info);
+}
+
+void PluginScheduler::cpu_burst_completed(std::shared_ptr<Thread> thread, int length) {
+    if (plugin->burst_completed == nullptr) {
+        return;
+    }
+
+    cpu_sim_thread_info info = thread_info(*thread);
+    plugin->burst_completed(state, &info, length);
+}
+
+bool PluginScheduler::is_preemptive() const {
+    // Only plugins that provide should_preempt ever preempt.
+    return plugin->should_preempt != nullptr;
+}
+
+bool PluginScheduler::should_preempt(std::shared_ptr<Thread> running) const {
+    if (plugin->should_preempt == nullptr || running == nullptr || ready_threads.empty()) {
+        return false;
+    }
+
+    cpu_sim_thread_info info = thread_info(*running);
+    return plugin->should_preempt(state, &info) != 0;
+}
+
+size_t PluginScheduler::size() const {
+    return ready_threads.size();
+}
+
+std::string PluginScheduler::metrics_summary() const {
+    /*
+    This returns something like this:
+
+    SCHEDULER PLUGIN:
+        Name:                 lottery
+        Decisions:                341
+    */
+
+    std::string message = "SCHEDULER PLUGIN:\n";
+    message += fmt::format("    {:<22}{:>9}\n", "Name:", plugin->name);
+    message += fmt::format("    {:<22}{:>9}\n", "Decisions:", decisions);
+    return message;
+}
+
+cpu_sim_thread_info PluginScheduler::thread_info(const Thread& thread) {
+    cpu_sim_thread_info info = {};
+    info.handle = (cpu_sim_thread_handle) (uintptr_t) &thread;
+    info.process_id = thread.process_id;
+    info.thread_id = thread.thread_id;
+    info.priority = thread.priority;
+    info.arrival_time = thread.arrival_time;
+    info.state_change_time = thread.state_change_time;
+    info.cpu_burst_left = 0;
+    if (!thread.bursts.empty() && thread.bursts.front()->burst_type == CPU) {
+        info.cpu_burst_left = thread.bursts.front()->length;
+    }
+    info.absolute_deadline = thread.absolute_deadline;
+    return info;
+}
+
+PluginScheduler::~PluginScheduler() {
+    plugin->destroy(state);
+    dlclose(library);
+}
@@ -0,0 +1,106 @@
+#ifndef PLUGIN_ALGORITHM_HPP
+#define PLUGIN_ALGORITHM_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include "algorithms/plugin/scheduler_plugin.h"
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    PluginScheduler:
+        A scheduling algorithm loaded at runtime from a shared object (see scheduler_plugin.h).
+
+        This is a derived class from the base scheduling algorithm class.
+
+        It forwards every call to the plugin, passing threads as cpu_sim_thread_info records.
+        The plugin keeps its own ready set; this class only remembers which threads are ready
+        so that it can check the thread the plugin picks.
+*/
+
+class PluginScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        path:
+            The file the plugin was loaded from.
+    */
+    std::string path;
+
+    /*
+        library:
+            The handle returned by dlopen().
+    */
+    void* library = nullptr;
+
+    /*
+        plugin:
+            The plugin's function table.
+    */
+    const cpu_sim_scheduler_plugin* plugin = nullptr;
+
+    /*
+        state:
+            The plugin's scheduler state, returned by its create function.
+    */
+    void* state = nullptr;
+
+    /*
+        ready_threads:
+            The threads that have been given to the plugin and not picked yet.
+    */
+    std::unordered_set<Thread*> ready_threads;
+
+    /*
+        decisions:
+            The number of scheduling decisions the plugin has made.
+    */
+    long decisions = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        PluginScheduler(path, slice):
+            Loads the plugin from path and creates its scheduler state. Prints the reason
+            and throws if the plugin cannot be loaded or was built for another ABI version.
+    */
+    PluginScheduler(const std::string& path, int slice = -1);
+
+    PluginScheduler(const PluginScheduler&) = delete;
+
+    PluginScheduler& operator=(const PluginScheduler&) = delete;
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    void cpu_burst_completed(std::shared_ptr<Thread> thread, int length);
+
+    bool should_preempt(std::shared_ptr<Thread> running) const;
+
+    bool is_preemptive() const;
+
+    size_t size() const;
+
+    std::string metrics_summary() const;
+
+    /*
+        thread_info(thread):
+            Describes a thread to the plugin.
+    */
+    static cpu_sim_thread_info thread_info(const Thread& thread);
+
+    /*
+        ~PluginScheduler():
+            Destroys the plugin's scheduler state and unloads the plugin.
+    */
+    ~PluginScheduler();
+};
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef SCHEDULER_PLUGIN_H
+#define SCHEDULER_PLUGIN_H
+
+/*
+    The scheduler plugin interface.
+
+    A scheduler plugin is a shared object that cpu-sim loads at startup with the
+    --scheduler-plugin flag. It is plain C, so a plugin can be built with any compiler
+    (and from any language with a C ABI) without linking against the simulator.
+
+    A plugin exports a single function named by CPU_SIM_PLUGIN_ENTRY:
+
+        const cpu_sim_scheduler_plugin* cpu_sim_get_scheduler_plugin(void);
+
+    which returns a pointer to a table that stays valid until the plugin is unloaded.
+    The simulator refuses to load a plugin whose abi_version differs from the one it
+    was built with. Within a version, new optional members are only ever appended to
+    the end of the table, and struct_size tells the simulator which of them a plugin
+    knows about.
+
+    See plugins/lottery.c for an example.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    CPU_SIM_PLUGIN_ABI_VERSION:
+        The version of this interface. Changed whenever an existing member changes.
+*/
+#define CPU_SIM_PLUGIN_ABI_VERSION 1
+
+/*
+    CPU_SIM_PLUGIN_ENTRY:
+        The name of the function a plugin must export.
+*/
+#define CPU_SIM_PLUGIN_ENTRY "cpu_sim_get_scheduler_plugin"
+
+/*
+    CPU_SIM_PLUGIN_EXPLANATION_SIZE:
+        The size of the explanation buffer in a decision, including the terminating NUL.
+*/
+#define CPU_SIM_PLUGIN_EXPLANATION_SIZE 256
+
+/*
+    cpu_sim_thread_handle:
+        Identifies a ready thread. Only meaningful to the simulator; a plugin hands it back
+        unchanged to say which thread should run next.
+*/
+typedef uint64_t cpu_sim_thread_handle;
+
+/*
+    cpu_sim_thread_info:
+        What a plugin is told about a thread. Times are in simulation ticks.
+*/
+typedef struct cpu_sim_thread_info {
+    cpu_sim_thread_handle handle;
+
+    int process_id;
+
+    int thread_id;
+
+    /* 0 = SYSTEM, 1 = INTERACTIVE, 2 = NORMAL, 3 = BATCH. */
+    int priority;
+
+    int arrival_time;
+
+    /* When the thread last changed state (for a ready thread, when it became ready). */
+    int state_change_time;
+
+    /* The CPU time left in the thread's current CPU burst. */
+    int cpu_burst_left;
+
+    /* When the current CPU burst should be finished, or -1 if it has no deadline. */
+    int absolute_deadline;
+} cpu_sim_thread_info;
+
+/*
+    cpu_sim_decision:
+        Filled in by pick_next. The simulator sets time_slice to -1 and explanation to
+        an empty string before the call.
+*/
+typedef struct cpu_sim_decision {
+    /* The handle of the ready thread that should run next. */
+    cpu_sim_thread_handle handle;
+
+    /* How long the thread may run before it is preempted, or -1 to run to the end of its burst. */
+    int time_slice;
+
+    /* Shown in verbose output. If left empty, the simulator writes a generic one. */
+    char explanation[CPU_SIM_PLUGIN_EXPLANATION_SIZE];
+} cpu_sim_decision;
+
+/*
+    cpu_sim_scheduler_plugin:
+        The table of functions a plugin provides. Every function takes the state pointer
+        returned by create. Members marked optional may be NULL.
+*/
+typedef struct cpu_sim_scheduler_plugin {
+    /* Must be CPU_SIM_PLUGIN_ABI_VERSION. */
+    uint32_t abi_version;
+
+    /* Must be sizeof(cpu_sim_scheduler_plugin) as the plugin was built. */
+    uint32_t struct_size;
+
+    /* A short name for the policy, shown in the metrics output. */
+    const char* name;
+
+    /* Creates the scheduler state. time_slice is the -s flag, or -1 if it was not given. Returns NULL on failure. */
+    void* (*create)(int time_slice);
+
+    /* Frees the scheduler state. */
+    void (*destroy)(void* state);
+
+    /* A thread became ready. */
+    void (*add_thread)(void* state, const cpu_sim_thread_info* thread);
+
+    /* Removes the thread that should run next from the ready set and describes it in decision. Only called
+       when at least one thread is ready. Returns 0 on success. */
+    int (*pick_next)(void* state, int current_time, cpu_sim_decision* decision);
+
+    /* Optional. A thread finished a CPU burst that took length ticks of CPU time. */
+    void (*burst_completed)(void* state, const cpu_sim_thread_info* thread, int length);
+
+    /* Optional. Returns non-zero if a ready thread should preempt the running thread right now. */
+    int (*should_preempt)(void* state, const cpu_sim_thread_info* running);
+} cpu_sim_scheduler_plugin;
+
+/*
+    cpu_sim_plugin_entry_fn:
+        The type of the function a plugin exports.
+*/
+typedef const cpu_sim_scheduler_plugin* (*cpu_sim_plugin_entry_fn)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,5 +1,6 @@
 #include "algorithms/priority/priority_algorithm.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 #include <sstream>
@@ -12,86 +13,194 @@
 */
 
 
-PRIORITYScheduler::PRIORITYScheduler(int slice) {
-    if (slice != -1) {
-        throw("PRIORITY must have a timeslice of -1");
+/*
+    LEVEL_NAMES:
+        The names of the priority levels, used in explanations.
+*/
+static const char* LEVEL_NAMES[4] = {"SYSTEM", "INTERACTIVE", "NORMAL", "BATCH"};
+
+/*
+    explain_decision(sd):
+        Formats the explanation of a priority decision, showing the queue sizes before and
+        after the thread was taken from its level. Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    const size_t* before = sd.queue_sizes;
+    size_t after[4] = {before[0], before[1], before[2], before[3]};
+    after[sd.source]--;
+
+    std::string message;
+    if (sd.details[1] != 0) {
+        message = fmt::format("Selected from {} queue after waiting {} ticks. ", LEVEL_NAMES[sd.source], sd.details[0]);
+    } else {
+        message = fmt::format("Selected from {} queue. ", LEVEL_NAMES[sd.source]);
     }
+    message += fmt::format("[S: {} I: {} N: {} B: {}] -> [S: {} I: {} N: {} B: {}]",
+        before[0], before[1], before[2], before[3], after[0], after[1], after[2], after[3]);
 
+    if (sd.affinity_hit) {
+        message += fmt::format(" Kept process {} on the CPU.", sd.thread->process_id);
+    }
+    return message;
 }
 
-std::shared_ptr<SchedulingDecision> PRIORITYScheduler::get_next_thread() {
-    if(!system_queue.empty()){
-
-        std::string message = "Selected from SYSTEM queue. [S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "] -> ";
-        std::string message2 = "[S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "]";
-        auto sd = std::make_shared<SchedulingDecision>();
-        sd->explanation = message + message2;
-        sd->thread = system_queue.front();
-        sd->time_slice = -1;
+PRIORITYScheduler::PRIORITYScheduler(int slice, bool preemptive, int aging_threshold) {
+    if (slice != -1) {
+        throw("PRIORITY must have a timeslice of -1");
+    }
+    this->preemptive = preemptive;
+    this->aging_threshold = aging_threshold;
 
-        system_queue.pop();
-        return sd; 
+}
 
+SchedulingDecision PRIORITYScheduler::get_next_thread() {
+    ThreadList* queues[4] = {&system_queue, &interactive_queue, &normal_queue, &batch_queue};
+
+    // Take from the level aging picked, or else from the highest non-empty level.
+    int level = get_aged_level();
+    bool aged = (level != -1);
+    if (!aged) {
+        for (level = SYSTEM; level <= BATCH && queues[level]->empty(); ++level) {}
+        if (level > BATCH) {
+            return SchedulingDecision();
+        }
     }
 
+    SchedulingDecision sd;
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        sd.queue_sizes[i] = queues[i]->size();
+    }
+    sd.source = level;
+    if (aged) {
+        sd.details[0] = current_time - queues[level]->front()->state_change_time;
+        sd.details[1] = 1;
+    }
 
-    if(!interactive_queue.empty()){
- 
-         std::string message = "Selected from INTERACTIVE queue. [S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "] -> ";
-        std::string message2 = "[S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "]";
-        auto sd = std::make_shared<SchedulingDecision>();
-        sd->explanation = message + message2;
-        sd->thread = interactive_queue.front();
-        sd->time_slice = -1; 
+    sd.thread = take_next(*queues[level], sd.affinity_hit);
+    sd.time_slice = -1;
+    sd.formatter = explain_decision;
+    return sd;
+}
 
-        interactive_queue.pop();
-        return sd;
+void PRIORITYScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    if (  thread->priority == SYSTEM){
+      system_queue.push_back(thread);
+    }
+    if (thread->priority == INTERACTIVE){
+      interactive_queue.push_back(thread);      
+    }
+    if (thread->priority == NORMAL){
+      normal_queue.push_back(thread);      
     }
+    if (thread->priority == BATCH){
+      batch_queue.push_back(thread);      
+    }  
+}
 
-    if(!normal_queue.empty()){
-        
-         std::string message = "Selected from NORMAL queue. [S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "] -> ";
-        std::string message2 = "[S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "]";
-        auto sd = std::make_shared<SchedulingDecision>();
-        sd->explanation = message + message2;
-        sd->thread = normal_queue.front();
-        sd->time_slice = -1;
+void PRIORITYScheduler::add_many(const std::vector<std::shared_ptr<Thread>>& threads) {
+    ThreadList* queues[4] = {&system_queue, &interactive_queue, &normal_queue, &batch_queue};
 
-        normal_queue.pop();
-        return sd; 
+    for (const auto& thread : threads) {
+        queues[thread->priority]->push_back(thread);
+    }
+}
 
+size_t PRIORITYScheduler::pick_up_to(size_t k, std::vector<SchedulingDecision>& out) {
+    // With aging or affinity, each pick depends on the ones before it, so they are made one
+    // by one.
+    if (aging_threshold > 0 || affinity_window > 0) {
+        return Scheduler::pick_up_to(k, out);
     }
 
+    ThreadList* queues[4] = {&system_queue, &interactive_queue, &normal_queue, &batch_queue};
+    size_t sizes[4];
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        sizes[i] = queues[i]->size();
+    }
 
-    if(!batch_queue.empty()){
-        
-         std::string message = "Selected from BATCH queue. [S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "] -> ";
-        std::string message2 = "[S: " + std::to_string(system_queue.size()) + " I: " + std::to_string(interactive_queue.size()) + " N: " + std::to_string(normal_queue.size()) + " B: " + std::to_string(batch_queue.size()) + "]";
-        auto sd = std::make_shared<SchedulingDecision>();
-        sd->explanation = message + message2;
-        sd->thread = batch_queue.front();
-        sd->time_slice = -1; 
+    // Otherwise the levels are emptied from the highest down.
+    size_t picked = std::min(k, size());
+    out.reserve(out.size() + picked);
+    int level = SYSTEM;
+
+    for (size_t i = 0; i < picked; i++) {
+        while (sizes[level] == 0) {
+            level++;
+        }
+
+        SchedulingDecision& sd = out.emplace_back();
+        std::copy(sizes, sizes + 4, sd.queue_sizes);
+        sd.source = level;
+        sd.thread = take_head(*queues[level]);
+        sd.time_slice = -1;
+        sd.formatter = explain_decision;
+        sizes[level]--;
+    }
+    return picked;
+}
 
-        batch_queue.pop();
-        return sd;
+std::shared_ptr<Thread> PRIORITYScheduler::take_for_migration() {
+    ThreadList* queues[4] = {&system_queue, &interactive_queue, &normal_queue, &batch_queue};
 
-    }  
-    return nullptr;
+    // The level get_next_thread() would take from.
+    int level = get_aged_level();
+    if (level == -1) {
+        for (level = SYSTEM; level <= BATCH && queues[level]->empty(); ++level) {}
+        if (level > BATCH) {
+            return nullptr;
+        }
+    }
+    return take_head(*queues[level]);
 }
 
-void PRIORITYScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
-    if (  thread->priority == SYSTEM){
-      system_queue.push(thread);
+int PRIORITYScheduler::get_aged_level() const {
+    if (aging_threshold <= 0) {
+        return -1;
     }
-    if (thread->priority == INTERACTIVE){
-      interactive_queue.push(thread);      
+
+    // Each level is FIFO, so its head is the thread that has waited the longest in it. Checking
+    // the four heads at selection time keeps aging O(1) instead of rescanning every queue.
+    const ThreadList* queues[4] = {&system_queue, &interactive_queue, &normal_queue, &batch_queue};
+    int best_level = -1;
+    int best_effective_level = BATCH + 1;
+    int best_waited = -1;
+
+    for (int level = SYSTEM; level <= BATCH; ++level) {
+        if (queues[level]->empty()) {
+            continue;
+        }
+
+        int waited = current_time - queues[level]->front()->state_change_time;
+        int effective_level = std::max((int) SYSTEM, level - waited / aging_threshold);
+
+        // Within the same effective level the longest waiting thread wins, so a promoted
+        // thread cannot be starved by a steady stream of native threads at that level.
+        if (effective_level < best_effective_level || (effective_level == best_effective_level && waited > best_waited)) {
+            best_effective_level = effective_level;
+            best_waited = waited;
+            best_level = level;
+        }
     }
-    if (thread->priority == NORMAL){
-      normal_queue.push(thread);      
+
+    // If the winner is the highest non-empty level, plain priority order already picks it.
+    for (int level = SYSTEM; level < best_level; ++level) {
+        if (!queues[level]->empty()) {
+            return best_level;
+        }
     }
-    if (thread->priority == BATCH){
-      batch_queue.push(thread);      
-    }  
+    return -1;
+}
+
+bool PRIORITYScheduler::should_preempt(std::shared_ptr<Thread> running) const {
+    if (!preemptive || running == nullptr) {
+        return false;
+    }
+
+    // Only a strictly higher priority (lower value) level can take the CPU.
+    if (running->priority > SYSTEM && !system_queue.empty()) return true;
+    if (running->priority > INTERACTIVE && !interactive_queue.empty()) return true;
+    if (running->priority > NORMAL && !normal_queue.empty()) return true;
+    return false;
 }
 
 size_t PRIORITYScheduler::size() const {
@@ -6,6 +6,7 @@
 #include <vector>
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
 #include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/thread_list/thread_list.hpp"
 
 /*
     PRIORITYScheduler:
@@ -24,21 +25,53 @@ public:
     //  Member variables
     //==================================================
 
-    std::queue<std::shared_ptr<Thread>> system_queue;
-    std::queue<std::shared_ptr<Thread>> interactive_queue;
-    std::queue<std::shared_ptr<Thread>> normal_queue;
-    std::queue<std::shared_ptr<Thread>> batch_queue;
+    ThreadList system_queue;
+    ThreadList interactive_queue;
+    ThreadList normal_queue;
+    ThreadList batch_queue;
+
+    /*
+        preemptive:
+            If true, a ready thread with a higher priority than the running thread
+            takes the CPU away from it immediately.
+    */
+    bool preemptive = false;
+
+    /*
+        aging_threshold:
+            How long a thread may wait before it is promoted. Every full threshold a thread
+            has waited raises it one level when selecting the next thread. A value of -1
+            disables aging.
+    */
+    int aging_threshold = -1;
 
 
     //==================================================
     //  Member functions
     //==================================================
 
-    PRIORITYScheduler(int slice = -1);
+    PRIORITYScheduler(int slice = -1, bool preemptive = false, int aging_threshold = -1);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    void add_many(const std::vector<std::shared_ptr<Thread>>& threads);
+
+    size_t pick_up_to(size_t k, std::vector<SchedulingDecision>& out);
+
+    std::shared_ptr<Thread> take_for_migration();
+
+    /*
+        get_aged_level():
+            Returns the level whose head thread has aged past a non-empty level with a
+            higher priority, or -1 if plain priority order should be used.
+    */
+    int get_aged_level() const;
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    bool should_preempt(std::shared_ptr<Thread> running) const;
 
-    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+    bool is_preemptive() const { return preemptive; }
 
     size_t size() const;
 
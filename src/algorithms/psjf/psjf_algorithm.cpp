@@ -0,0 +1,48 @@
+#include "algorithms/psjf/psjf_algorithm.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where the logic for the predicted shortest-job-first algorithm is defined.
+*/
+
+PSJFScheduler::PSJFScheduler(int slice) {
+    if (slice != -1) {
+        throw("PSJF must have a timeslice of -1");
+    }
+}
+
+/*
+    explain_decision(sd):
+        Formats the explanation of a PSJF decision. Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    return fmt::format("Selected from {} threads. Predicted burst of {:.2f} ticks. Will run to completion of burst.",
+        sd.queue_sizes[0], sd.estimate);
+}
+
+SchedulingDecision PSJFScheduler::get_next_thread() {
+    if (PSJFheap.empty()) {
+        return SchedulingDecision();
+    }
+
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = PSJFheap.size();
+    sd.thread = PSJFheap.pop();
+    sd.time_slice = -1;
+    sd.estimate = sd.thread->predictor.predict();
+    sd.formatter = explain_decision;
+    return sd;
+}
+
+void PSJFScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    PSJFheap.push(thread);
+}
+
+size_t PSJFScheduler::size() const {
+    return PSJFheap.size();
+}
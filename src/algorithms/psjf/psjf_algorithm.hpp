@@ -0,0 +1,57 @@
+#ifndef PSJF_ALGORITHM_HPP
+#define PSJF_ALGORITHM_HPP
+
+#include <memory>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/thread_heap/thread_heap.hpp"
+
+/*
+    ShorterPrediction:
+        Orders threads by the predicted length of their next CPU burst.
+*/
+
+struct ShorterPrediction {
+    bool operator()(const Thread& a, const Thread& b) const {
+        return a.predictor.predict() < b.predictor.predict();
+    }
+};
+
+/*
+    PSJFScheduler:
+        A representation of a shortest-job-first scheduling algorithm that only uses
+        predicted burst lengths.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        It never looks at the actual bursts in Thread::bursts. Instead, each thread's
+        BurstPredictor guesses the next burst length from the bursts it has already run,
+        and the thread with the shortest prediction runs to the end of its burst.
+*/
+
+class PSJFScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        PSJFheap:
+            The ready threads, ordered by predicted burst length.
+    */
+    ThreadHeap<ShorterPrediction> PSJFheap;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    PSJFScheduler(int slice = -1);
+
+    SchedulingDecision get_next_thread();
+
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    size_t size() const;
+};
+
+#endif
@@ -1,9 +1,13 @@
 #include "algorithms/rr/rr_algorithm.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 #include <sstream>
 
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
 /*
     Here is where you should define the logic for the round robin algorithm.
 */
@@ -16,25 +20,57 @@ RRScheduler::RRScheduler(int slice) {
     }
 }
 
-std::shared_ptr<SchedulingDecision> RRScheduler::get_next_thread() {
-    if(!RRqueue.empty()){
-        
-    std::string message = "Selected from " + std::to_string(RRqueue.size()) + " threads. Will run for at most " + std::to_string(RRScheduler::time_slice) + " ticks.";
+/*
+    explain_decision(sd):
+        Formats the explanation of a round robin decision. Only called when it is printed.
+*/
+static std::string explain_decision(const SchedulingDecision& sd) {
+    std::string message = fmt::format("Selected from {} threads. Will run for at most {} ticks.", sd.queue_sizes[0], sd.time_slice);
 
-    auto sd = std::make_shared<SchedulingDecision>();
-        sd->explanation = message;
-        sd->thread = RRqueue.front();
-        sd->time_slice = Scheduler::time_slice; 
+    if (sd.affinity_hit) {
+        message += fmt::format(" Kept process {} on the CPU.", sd.thread->process_id);
+    }
+    return message;
+}
+
+SchedulingDecision RRScheduler::get_next_thread() {
+    if (RRqueue.empty()) {
+        return SchedulingDecision();
+    }
 
-    RRqueue.pop();
+    SchedulingDecision sd;
+    sd.queue_sizes[0] = RRqueue.size();
+    sd.thread = take_next(RRqueue, sd.affinity_hit);
+    sd.time_slice = Scheduler::time_slice;
+    sd.formatter = explain_decision;
     return sd;
+}
+
+void RRScheduler::add_to_ready_queue(const std::shared_ptr<Thread>& thread) {
+    RRqueue.push_back(thread);
+}
+
+size_t RRScheduler::pick_up_to(size_t k, std::vector<SchedulingDecision>& out) {
+    // With affinity, each pick depends on the ones before it, so they are made one by one.
+    if (affinity_window > 0) {
+        return Scheduler::pick_up_to(k, out);
+    }
+
+    size_t picked = std::min(k, RRqueue.size());
+    out.reserve(out.size() + picked);
 
+    for (size_t i = 0; i < picked; i++) {
+        SchedulingDecision& sd = out.emplace_back();
+        sd.queue_sizes[0] = RRqueue.size();
+        sd.thread = take_head(RRqueue);
+        sd.time_slice = Scheduler::time_slice;
+        sd.formatter = explain_decision;
     }
-    return nullptr;
+    return picked;
 }
 
-void RRScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
-    RRqueue.push(thread);
+std::shared_ptr<Thread> RRScheduler::take_for_migration() {
+    return RRqueue.empty() ? nullptr : take_head(RRqueue);
 }
 
 size_t RRScheduler::size() const {
@@ -2,9 +2,9 @@
 #define RR_ALGORITHM_HPP
 
 #include <memory>
-#include <queue>
 #include <stdexcept>
 #include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/thread_list/thread_list.hpp"
 
 /*
     RRScheduler:
@@ -24,10 +24,10 @@ public:
     //==================================================
 
      /*
-        FCFSqueue:
-            A queue of threads to be ran using a FCFS algorithm
+        RRqueue:
+            A queue of threads to be ran using a round robin algorithm
     */
-    std::queue<std::shared_ptr<Thread>> RRqueue;
+    ThreadList RRqueue;
 
 
   
@@ -37,9 +37,13 @@ public:
 
     RRScheduler(int slice = 3);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    SchedulingDecision get_next_thread();
 
-    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+    void add_to_ready_queue(const std::shared_ptr<Thread>& thread);
+
+    size_t pick_up_to(size_t k, std::vector<SchedulingDecision>& out);
+
+    std::shared_ptr<Thread> take_for_migration();
 
     size_t size() const;
 };
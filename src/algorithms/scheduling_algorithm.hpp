@@ -1,11 +1,17 @@
 #ifndef SCHEDULING_ALGORITHM_HPP
 #define SCHEDULING_ALGORITHM_HPP
 
+#include <iterator>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include "types/enums.hpp"
 #include "types/event/event.hpp"
+#include "types/group/group.hpp"
 #include "types/scheduling_decision/scheduling_decision.hpp"
 #include "types/thread/thread.hpp"
+#include "utilities/thread_list/thread_list.hpp"
 
 /*
     Scheduler:
@@ -31,6 +37,37 @@ public:
     */
     int time_slice = -1;
 
+    /*
+        current_time:
+            The current simulation time. The simulation updates it before every call to
+            get_next_thread(), so that algorithms that depend on how long threads have been
+            waiting (like priority aging) can use it.
+    */
+    int current_time = 0;
+
+    /*
+        thread_switch_overhead, process_switch_overhead:
+            The dispatch overheads from the simulation file. Set by the simulation once the
+            file has been read, for algorithms that take dispatch cost into account.
+    */
+    int thread_switch_overhead = 0;
+    int process_switch_overhead = 0;
+
+    /*
+        affinity_window:
+            If greater than zero, FIFO ready queues prefer a thread of affinity_process_id that is
+            at most this many positions behind the head, which avoids a process switch. The head
+            can be passed over at most this many times, so no thread waits forever. 0 disables it.
+    */
+    int affinity_window = 0;
+
+    /*
+        affinity_process_id:
+            The process of the thread that last ran on the CPU, or -1 if none has. The simulation
+            updates it before every call to get_next_thread().
+    */
+    int affinity_process_id = -1;
+
     //==================================================
     //  Member functions
     //==================================================
@@ -39,8 +76,8 @@ public:
         get_next_thread():
             This function tries to get the next thread to run based on the scheduling algorithm.
 
-            It returns a SchedulingDecision object (see the SchedulingDecision class for more info)
-            that contains:
+            It returns a SchedulingDecision by value (see the SchedulingDecision class for more info),
+            so making a decision does not allocate memory. It contains:
                 The next thread, or nullptr if no thread is available.
                 The time slice if the algorithm is preemptive.
                 A message explaining the decision.
@@ -48,7 +85,7 @@ public:
                         "Selected from 9 threads. Will run to completion of burst."
                     This message is used when printing the state transitions (see the Logger class).
     */
-    virtual std::shared_ptr<SchedulingDecision> get_next_thread() = 0;
+    virtual SchedulingDecision get_next_thread() = 0;
 
     /*
         add_to_ready_queue(Thread):
@@ -56,8 +93,88 @@ public:
             algorithm. For first come, first served this might be a single queue, but for more complex
             algorithms you may have multiple queues, and there may be more logic involved in determining
             which queue the thread should be placed in.
+
+            The simulation keeps the thread alive while it is ready, so the queues can hold
+            plain pointers to it (see ThreadList).
+    */
+    virtual void add_to_ready_queue(const std::shared_ptr<Thread>& thread) = 0;
+
+    /*
+        add_many(threads):
+            Adds several threads to the ready queue(s), in order, as if add_to_ready_queue()
+            was called for each of them. Used when many threads become ready at the same time.
+            Algorithms can override it with a cheaper bulk insert.
+    */
+    virtual void add_many(const std::vector<std::shared_ptr<Thread>>& threads) {
+        for (const auto& thread : threads) {
+            add_to_ready_queue(thread);
+        }
+    }
+
+    /*
+        pick_up_to(k, out):
+            Makes up to k scheduling decisions, as if get_next_thread() was called k times,
+            and appends them to out. Stops early when the ready queue(s) run out. Returns the
+            number of decisions made. Used when several CPUs that share the ready queue(s)
+            dispatch at the same time. Algorithms can override it with a cheaper bulk pick.
+    */
+    virtual size_t pick_up_to(size_t k, std::vector<SchedulingDecision>& out) {
+        size_t picked = 0;
+        for (; picked < k; picked++) {
+            auto decision = get_next_thread();
+            if (decision.thread == nullptr) {
+                break;
+            }
+            out.push_back(std::move(decision));
+        }
+        return picked;
+    }
+
+    /*
+        cpu_burst_completed(thread, length):
+            Called by the simulation when a thread finishes a CPU burst that took length ticks
+            of CPU time in total. Algorithms that learn from observed bursts can override it.
+    */
+    virtual void cpu_burst_completed(std::shared_ptr<Thread> thread, int length) {}
+
+    /*
+        add_group(group):
+            Called by the simulation for every group in the simulation file, before any
+            thread arrives. Algorithms that share CPU time between groups override it.
+    */
+    virtual void add_group(const Group& group) {}
+
+    /*
+        next_wakeup_time():
+            Returns the time at which a ready thread that cannot run now (e.g., because its
+            group is throttled) will be able to run, or -1 if there is none. The simulation
+            invokes the dispatcher at that time if the CPU is idle.
+    */
+    virtual int next_wakeup_time() const { return -1; }
+
+    /*
+        should_preempt(running):
+            Returns true if a thread in the ready queue(s) should take the CPU away from the
+            running thread right now. Non-preemptive algorithms never preempt, which is the default.
+    */
+    virtual bool should_preempt(std::shared_ptr<Thread> running) const { return false; }
+
+    /*
+        is_preemptive():
+            Returns true if should_preempt() may ever return true, so that the simulation
+            only asks algorithms that can preempt. Non-preemptive algorithms return false,
+            which is the default.
     */
-    virtual void add_to_ready_queue(std::shared_ptr<Thread> thread) = 0;
+    virtual bool is_preemptive() const { return false; }
+
+    /*
+        take_for_migration():
+            Removes a ready thread so that it can be moved to another core's ready queue,
+            and returns it, or nullptr if there is none. By default this is the thread that
+            get_next_thread() would pick. Algorithms whose picks charge the thread or keep
+            other accounting override it, since the thread does not run here.
+    */
+    virtual std::shared_ptr<Thread> take_for_migration() { return get_next_thread().thread; }
 
     /*
         size():
@@ -72,6 +189,55 @@ public:
     */
     bool empty() const { return size() == 0; }
 
+    /*
+        metrics_summary():
+            Returns algorithm-specific metrics to print at the end of the simulation
+            (when the -m flag is set), or an empty string if the algorithm has none.
+    */
+    virtual std::string metrics_summary() const { return ""; }
+
+    /*
+        take_next(queue, affinity_hit):
+            Removes and returns the next thread of a FIFO ready queue, which must not be empty.
+            This is the head, unless affinity is enabled and a thread of the same process as the
+            last thread on the CPU is found within the affinity window. affinity_hit is set to
+            true if the head was passed over for such a thread.
+    */
+    std::shared_ptr<Thread> take_next(ThreadList& queue, bool& affinity_hit) {
+        auto chosen = queue.begin();
+        Thread* head = queue.front();
+        affinity_hit = false;
+
+        if (affinity_window > 0 && head->process_id != affinity_process_id && head->affinity_bypasses < affinity_window) {
+            int position = 1;
+            for (auto it = std::next(queue.begin()); it != queue.end() && position <= affinity_window; ++it, ++position) {
+                if ((*it)->process_id == affinity_process_id) {
+                    head->affinity_bypasses++;
+                    chosen = it;
+                    affinity_hit = true;
+                    break;
+                }
+            }
+        }
+
+        Thread* thread = *chosen;
+        queue.erase(chosen);
+        thread->affinity_bypasses = 0;
+        return thread->shared_from_this();
+    }
+
+    /*
+        take_head(queue):
+            Removes and returns the head of a FIFO ready queue, which must not be empty, for a
+            thread that leaves without running here. No affinity bypass applies, since that is
+            about this CPU's last process.
+    */
+    std::shared_ptr<Thread> take_head(ThreadList& queue) {
+        std::shared_ptr<Thread> thread = queue.pop_front();
+        thread->affinity_bypasses = 0;
+        return thread;
+    }
+
     /*
         ~Scheduler():
             This is a virtual destructor, provided as a best practice. I do not think that
@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <malloc.h>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "algorithms/fcfs/fcfs_algorithm.hpp"
+#include "algorithms/rr/rr_algorithm.hpp"
+#include "algorithms/priority/priority_algorithm.hpp"
+#include "algorithms/arr/arr_algorithm.hpp"
+#include "algorithms/edf/edf_algorithm.hpp"
+#include "algorithms/gang/gang_algorithm.hpp"
+#include "algorithms/hfs/hfs_algorithm.hpp"
+#include "algorithms/layered/layered_algorithm.hpp"
+#include "algorithms/psjf/psjf_algorithm.hpp"
+
+#include "types/enums.hpp"
+
+/*
+    A microbenchmark of the scheduling algorithms on their own, without the simulation.
+
+    Each algorithm is given synthetic threads and driven through three phases:
+
+        enqueue:  add_to_ready_queue() until the ready queue holds <depth> threads
+        steady:   get_next_thread() followed by add_to_ready_queue() of the same thread,
+                  so the queue stays at <depth> threads (one op is the pair)
+        dequeue:  get_next_thread() until the ready queue is empty
+
+    The enqueue and dequeue phases are repeated until they add up to at least --ops ops.
+    Results are printed as CSV, one line per (algorithm, mix, depth, phase):
+
+        scheduler,mix,depth,phase,ops,ns_per_op,allocs_per_op,peak_bytes
+
+    peak_bytes is the most heap memory the algorithm held, above what was in use when it
+    was created, at any point up to the end of the phase. The threads themselves are
+    created beforehand and are not counted.
+
+    Usage: scheduler-bench [--depths 10,1000,...] [--ops N] [--only NAME]
+*/
+
+//==================================================
+//  Allocation counting
+//==================================================
+
+/*
+    The global operator new and delete are replaced to count allocations and the bytes in
+    use. The benchmark is single threaded, so plain counters are enough.
+*/
+static long allocations = 0;
+static long bytes_in_use = 0;
+static long peak_bytes_in_use = 0;
+
+void* operator new(size_t size) {
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    allocations++;
+    bytes_in_use += malloc_usable_size(pointer);
+    if (bytes_in_use > peak_bytes_in_use) {
+        peak_bytes_in_use = bytes_in_use;
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        bytes_in_use -= malloc_usable_size(pointer);
+        std::free(pointer);
+    }
+}
+
+void operator delete[](void* pointer) noexcept {
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+//==================================================
+//  Workloads
+//==================================================
+
+/*
+    Mix:
+        A priority mix: the share of threads at each of the four priority levels.
+*/
+struct Mix {
+    const char* name;
+    double weights[4];
+};
+
+static const Mix MIXES[] = {
+    {"uniform", {1, 1, 1, 1}},
+    {"batch-heavy", {2, 8, 20, 70}},
+    {"normal-only", {0, 0, 1, 0}},
+};
+
+/*
+    THREADS_PER_PROCESS, GROUPS:
+        How the synthetic threads are split into processes, and the processes into groups
+        (for the algorithms that use groups).
+*/
+static const int THREADS_PER_PROCESS = 8;
+static const int GROUPS = 4;
+
+/*
+    make_threads(count, mix, seed):
+        Creates the synthetic threads for one workload. Each has a single CPU burst of 1 to 20
+        ticks and, for EDF, a deadline within the next 1000 ticks.
+*/
+static std::vector<std::shared_ptr<Thread>> make_threads(size_t count, const Mix& mix, unsigned seed) {
+    std::mt19937 random(seed);
+    std::discrete_distribution<int> priority(std::begin(mix.weights), std::end(mix.weights));
+    std::uniform_int_distribution<int> length(1, 20);
+    std::uniform_int_distribution<int> deadline(1, 1000);
+
+    std::vector<std::shared_ptr<Thread>> threads;
+    threads.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        auto thread = std::make_shared<Thread>(0, i, i / THREADS_PER_PROCESS, (ProcessPriority) priority(random));
+        thread->bursts.push(std::make_shared<Burst>(BurstType::CPU, length(random)));
+        thread->state_change_time = 0;
+        thread->absolute_deadline = deadline(random);
+        threads.push_back(thread);
+    }
+    return threads;
+}
+
+/*
+    reset_threads(threads):
+        Clears the state the previous algorithm left in the threads.
+*/
+static void reset_threads(const std::vector<std::shared_ptr<Thread>>& threads) {
+    for (const auto& thread : threads) {
+        thread->virtual_runtime = 0;
+        thread->heap_index = -1;
+        thread->ready_prev = nullptr;
+        thread->ready_next = nullptr;
+        thread->affinity_bypasses = 0;
+    }
+}
+
+/*
+    add_groups(scheduler, processes):
+        Splits the processes into GROUPS groups with different shares.
+*/
+static void add_groups(Scheduler& scheduler, int processes) {
+    for (int g = 0; g < GROUPS; g++) {
+        Group group("group" + std::to_string(g), 512 * (g + 1), -1, 100);
+        for (int process_id = g; process_id < processes; process_id += GROUPS) {
+            group.process_ids.push_back(process_id);
+        }
+        scheduler.add_group(group);
+    }
+}
+
+//==================================================
+//  Algorithms
+//==================================================
+
+struct Algorithm {
+    const char* name;
+    std::function<std::shared_ptr<Scheduler>()> create;
+};
+
+static const std::vector<Algorithm> ALGORITHMS = {
+    {"FCFS", [] { return std::make_shared<FCFSScheduler>(); }},
+    {"RR", [] { return std::make_shared<RRScheduler>(3); }},
+    {"PRIORITY", [] { return std::make_shared<PRIORITYScheduler>(); }},
+    {"PRIORITY_AGING", [] { return std::make_shared<PRIORITYScheduler>(-1, false, 100); }},
+    {"EDF", [] { return std::make_shared<EDFScheduler>(); }},
+    {"GANG", [] { return std::make_shared<GANGScheduler>(3); }},
+    {"ARR", [] { return std::make_shared<ARRScheduler>(3); }},
+    {"HFS", [] { return std::make_shared<HFSScheduler>(3); }},
+    {"PSJF", [] { return std::make_shared<PSJFScheduler>(); }},
+    {"PRIORITY_RR", [] { return std::make_shared<Layered<PriorityLevels, RoundRobin>>(3); }},
+    {"PRIORITY_CFS", [] { return std::make_shared<Layered<PriorityLevels, FairShare>>(3); }},
+    {"TENANT_RR", [] { return std::make_shared<Layered<Tenants, RoundRobin>>(3); }},
+    {"TENANT_CFS", [] { return std::make_shared<Layered<Tenants, FairShare>>(3); }},
+};
+
+//==================================================
+//  Measurement
+//==================================================
+
+/*
+    Phase:
+        The counters for one phase of a run.
+*/
+struct Phase {
+    long ops = 0;
+    double seconds = 0.0;
+    long allocations = 0;
+};
+
+static void print_row(const char* scheduler, const char* mix, size_t depth, const char* phase, const Phase& result, long peak_bytes) {
+    double ops = std::max(1L, result.ops);
+    std::cout << scheduler << ',' << mix << ',' << depth << ',' << phase << ','
+              << result.ops << ',' << result.seconds * 1e9 / ops << ','
+              << result.allocations / ops << ',' << peak_bytes << '\n';
+}
+
+/*
+    run(algorithm, mix, threads, min_ops):
+        Runs the three phases for one algorithm and prints their results.
+*/
+static void run(const Algorithm& algorithm, const Mix& mix, const std::vector<std::shared_ptr<Thread>>& threads, long min_ops) {
+    using clock = std::chrono::steady_clock;
+    reset_threads(threads);
+
+    long base_bytes = bytes_in_use;
+    peak_bytes_in_use = bytes_in_use;
+
+    std::shared_ptr<Scheduler> scheduler = algorithm.create();
+    add_groups(*scheduler, (threads.size() + THREADS_PER_PROCESS - 1) / THREADS_PER_PROCESS);
+
+    Phase enqueue, steady, dequeue;
+    int time = 0;
+
+    // Fill and drain the queue until both phases have done enough ops. The last fill is
+    // left in the queue for the steady phase.
+    while (true) {
+        long start_allocations = allocations;
+        auto start = clock::now();
+        for (const auto& thread : threads) {
+            scheduler->add_to_ready_queue(thread);
+        }
+        enqueue.seconds += std::chrono::duration<double>(clock::now() - start).count();
+        enqueue.allocations += allocations - start_allocations;
+        enqueue.ops += threads.size();
+
+        if (enqueue.ops >= min_ops) {
+            break;
+        }
+
+        start_allocations = allocations;
+        start = clock::now();
+        while (scheduler->size() > 0) {
+            scheduler->current_time = time++;
+            scheduler->get_next_thread();
+        }
+        dequeue.seconds += std::chrono::duration<double>(clock::now() - start).count();
+        dequeue.allocations += allocations - start_allocations;
+        dequeue.ops += threads.size();
+    }
+    print_row(algorithm.name, mix.name, threads.size(), "enqueue", enqueue, peak_bytes_in_use - base_bytes);
+
+    long start_allocations = allocations;
+    auto start = clock::now();
+    for (long i = 0; i < min_ops; i++) {
+        scheduler->current_time = time++;
+        SchedulingDecision decision = scheduler->get_next_thread();
+        if (decision.thread != nullptr) {
+            scheduler->add_to_ready_queue(decision.thread);
+        }
+    }
+    steady.seconds = std::chrono::duration<double>(clock::now() - start).count();
+    steady.allocations = allocations - start_allocations;
+    steady.ops = min_ops;
+    print_row(algorithm.name, mix.name, threads.size(), "steady", steady, peak_bytes_in_use - base_bytes);
+
+    start_allocations = allocations;
+    start = clock::now();
+    while (scheduler->size() > 0) {
+        scheduler->current_time = time++;
+        scheduler->get_next_thread();
+    }
+    dequeue.seconds += std::chrono::duration<double>(clock::now() - start).count();
+    dequeue.allocations += allocations - start_allocations;
+    dequeue.ops += threads.size();
+    print_row(algorithm.name, mix.name, threads.size(), "dequeue", dequeue, peak_bytes_in_use - base_bytes);
+}
+
+/*
+    parse_depths(text):
+        Parses a comma-separated list of queue depths. Returns an empty list if it is invalid.
+*/
+static std::vector<size_t> parse_depths(const std::string& text) {
+    std::vector<size_t> depths;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        try {
+            long depth = std::stol(item);
+            if (depth <= 0) {
+                return {};
+            }
+            depths.push_back(depth);
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return depths;
+}
+
+int main(int argc, char** argv) {
+    std::vector<size_t> depths = {10, 1000, 100000, 1000000};
+    long min_ops = 200000;
+    std::string only = "";
+
+    static struct option options[] = {
+        {"depths", required_argument, 0, 'd'},
+        {"ops",    required_argument, 0, 'o'},
+        {"only",   required_argument, 0, 'n'},
+        {0, 0, 0, 0}
+    };
+
+    int option;
+    while ((option = getopt_long(argc, argv, "d:o:n:", options, nullptr)) != -1) {
+        switch (option) {
+            case 'd':
+                depths = parse_depths(optarg);
+                break;
+            case 'o':
+                min_ops = std::atol(optarg);
+                break;
+            case 'n':
+                only = optarg;
+                break;
+            default:
+                depths.clear();
+        }
+    }
+
+    if (depths.empty() || min_ops <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [--depths 10,1000,...] [--ops N] [--only NAME]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "scheduler,mix,depth,phase,ops,ns_per_op,allocs_per_op,peak_bytes\n";
+
+    for (size_t depth : depths) {
+        for (const Mix& mix : MIXES) {
+            auto threads = make_threads(depth, mix, depth);
+            for (const Algorithm& algorithm : ALGORITHMS) {
+                if (only.empty() || only == algorithm.name) {
+                    run(algorithm, mix, threads, min_ops);
+                }
+            }
+            std::cout.flush();
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "simulation/simulation.hpp"
+#include "types/workload/workload.hpp"
+#include "utilities/task_runtime/task_runtime.hpp"
+
+/*
+    A scaling benchmark of the TaskRuntime on batches of independent simulations, the kind of
+    job that sweeps and batch runs hand it.
+
+    The simulation file is read once. For each number of workers, a TaskRuntime with that many
+    workers runs the batch: --runs simulations of the file, cycling through the algorithms
+    below, with parallel_for. Each batch is timed --repeat times and the fastest time is kept.
+    Results are printed as CSV, one line per number of workers:
+
+        workers,runs,seconds,runs_per_second,speedup,efficiency
+
+    speedup is relative to the first number of workers, and efficiency is the speedup divided
+    by how many times more workers there are. Workers beyond the hardware threads cannot
+    speed anything up, so the number of hardware threads is printed to stderr.
+
+    Usage: runtime-bench [--workers 1,2,4,...] [--runs N] [--repeat N] [--pin] filename
+*/
+
+/*
+    ALGORITHMS:
+        The algorithms the simulations of a batch cycle through, so that the tasks are not
+        all the same length.
+*/
+static const char* ALGORITHMS[] = {"FCFS", "RR", "PRIORITY", "HFS", "ARR", "PRIORITY_CFS"};
+
+/*
+    batch_flags(filename, runs):
+        The flags of every simulation in a batch.
+*/
+static std::vector<FlagOptions> batch_flags(const std::string& filename, size_t runs) {
+    std::vector<FlagOptions> batch;
+    for (size_t i = 0; i < runs; i++) {
+        FlagOptions flags;
+        flags.filename = filename;
+        flags.scheduler = ALGORITHMS[i % std::size(ALGORITHMS)];
+        if (uses_time_slice(flags.scheduler)) {
+            flags.time_slice = 1 + i % 5;
+        }
+        batch.push_back(flags);
+    }
+    return batch;
+}
+
+/*
+    run_batch(runtime, batch, workload):
+        Runs every simulation of the batch on the runtime, and returns how long it took in
+        seconds. The elapsed times of the simulations are added up into checksum, so that
+        none of the work can be left out.
+*/
+static double run_batch(TaskRuntime& runtime, const std::vector<FlagOptions>& batch, std::shared_ptr<const Workload> workload, long& checksum) {
+    std::atomic<long> total(0);
+
+    auto start = std::chrono::steady_clock::now();
+    runtime.parallel_for(batch.size(), [&](size_t i) {
+        Simulation simulation(batch[i], workload);
+        simulation.simulate();
+        total += simulation.calculate_statistics().total_time;
+    });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    checksum = total;
+    return seconds;
+}
+
+/*
+    parse_workers(text):
+        Parses a comma-separated list of worker counts. Returns an empty list if it is invalid.
+*/
+static std::vector<int> parse_workers(const std::string& text) {
+    std::vector<int> workers;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        try {
+            int count = std::stoi(item);
+            if (count <= 0) {
+                return {};
+            }
+            workers.push_back(count);
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return workers;
+}
+
+int main(int argc, char** argv) {
+    std::vector<int> workers = {1, 2, 4, 8, 16, 32, 64};
+    long runs = 512;
+    int repeat = 3;
+    bool pin = false;
+
+    static struct option options[] = {
+        {"workers", required_argument, 0, 'w'},
+        {"runs",    required_argument, 0, 'r'},
+        {"repeat",  required_argument, 0, 'n'},
+        {"pin",     no_argument,       0, 'p'},
+        {0, 0, 0, 0}
+    };
+
+    int option;
+    while ((option = getopt_long(argc, argv, "w:r:n:p", options, nullptr)) != -1) {
+        switch (option) {
+            case 'w':
+                workers = parse_workers(optarg);
+                break;
+            case 'r':
+                runs = std::atol(optarg);
+                break;
+            case 'n':
+                repeat = std::atoi(optarg);
+                break;
+            case 'p':
+                pin = true;
+                break;
+            default:
+                workers.clear();
+        }
+    }
+
+    if (workers.empty() || runs <= 0 || repeat <= 0 || optind != argc - 1) {
+        std::cerr << "Usage: " << argv[0] << " [--workers 1,2,4,...] [--runs N] [--repeat N] [--pin] filename" << std::endl;
+        return 1;
+    }
+
+    std::shared_ptr<Workload> workload = std::make_shared<Workload>();
+    try {
+        workload->read(argv[optind]);
+    } catch (const std::exception&) {
+        return 1;
+    }
+    std::vector<FlagOptions> batch = batch_flags(argv[optind], runs);
+
+    std::cerr << "# " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    std::cout << "workers,runs,seconds,runs_per_second,speedup,efficiency\n";
+
+    double first_seconds = 0.0;
+    long first_checksum = 0;
+    for (int count : workers) {
+        TaskRuntime runtime(count, pin);
+
+        double seconds = 0.0;
+        for (int i = 0; i < repeat; i++) {
+            long checksum;
+            double time = run_batch(runtime, batch, workload, checksum);
+            seconds = (i == 0) ? time : std::min(seconds, time);
+
+            // Every number of workers must simulate exactly the same thing.
+            if (first_checksum == 0) {
+                first_checksum = checksum;
+            } else if (checksum != first_checksum) {
+                std::cerr << "The results with " << count << " workers differ." << std::endl;
+                return 1;
+            }
+        }
+
+        if (first_seconds == 0.0) {
+            first_seconds = seconds;
+        }
+        double speedup = first_seconds / seconds;
+        double efficiency = speedup * workers.front() / count;
+        std::cout << count << ',' << runs << ',' << seconds << ',' << runs / seconds << ','
+                  << speedup << ',' << efficiency << '\n';
+        std::cout.flush();
+    }
+    return 0;
+}
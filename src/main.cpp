@@ -2,7 +2,9 @@
 #include <string>
 
 #include "utilities/flags/flags.hpp"
+#include "simulation/batch.hpp"
 #include "simulation/simulation.hpp"
+#include "simulation/sweep.hpp"
 
 int main(int argc, char** argv) {
     int error = 0;
@@ -16,8 +18,20 @@ int main(int argc, char** argv) {
     }
 
     try {
-        Simulation simulation(flags);
-        simulation.run();
+        if (flags.sweep) {
+            Sweep sweep(flags);
+            sweep.run();
+            sweep.print_results(std::cout);
+        } else if (flags.filenames.size() > 1 || flags.output_dir != "") {
+            Batch batch(flags);
+            batch.run();
+            if (!batch.print_results(std::cout)) {
+                error = 1;
+            }
+        } else {
+            Simulation simulation(flags);
+            simulation.run();
+        }
      } catch (...) {
         print_usage();
         return 1;
@@ -0,0 +1,145 @@
+#include "simulation/batch.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+#include "simulation/simulation.hpp"
+#include "utilities/task_runtime/task_runtime.hpp"
+
+Batch::Batch(const FlagOptions& flags) {
+    this->flags = flags;
+
+    if (flags.output_dir != "") {
+        std::set<std::string> names;
+        for (const std::string& filename : flags.filenames) {
+            std::string name = output_name(flags, filename);
+            if (!names.insert(name).second) {
+                std::cerr << "Two files would be written to " << name << " in " << flags.output_dir << "." << std::endl;
+                throw(std::logic_error("Bad output directory."));
+            }
+        }
+    }
+
+    this->jobs = (flags.jobs > 0) ? flags.jobs : std::max(1u, std::thread::hardware_concurrency());
+    this->jobs = std::min(this->jobs, (int) flags.filenames.size());
+    if (flags.scheduler == "PLUGIN") {
+        this->jobs = 1;
+    }
+}
+
+void Batch::run() {
+    if (this->flags.output_dir != "") {
+        std::error_code error;
+        std::filesystem::create_directories(this->flags.output_dir, error);
+        if (!std::filesystem::is_directory(this->flags.output_dir)) {
+            std::cerr << "Unable to create output directory: " << this->flags.output_dir << std::endl;
+            throw(std::logic_error("Bad output directory."));
+        }
+    }
+
+    this->results.assign(this->flags.filenames.size(), BatchResult());
+
+    // Each result goes to its file's place, whichever worker simulates it.
+    TaskRuntime runtime(this->jobs);
+    runtime.parallel_for(this->flags.filenames.size(), [this](size_t index) {
+        this->simulate(index);
+    });
+}
+
+void Batch::simulate(size_t index) {
+    const std::string& filename = this->flags.filenames[index];
+    BatchResult& result = this->results[index];
+
+    FlagOptions file_flags = this->flags;
+    file_flags.filename = filename;
+
+    std::ostringstream output;
+    try {
+        Simulation simulation(file_flags, nullptr, output);
+        result.stats = simulation.run();
+    } catch (...) {
+        result.failed = true;
+    }
+    result.output = output.str();
+
+    if (this->flags.output_dir != "" && !result.failed) {
+        std::filesystem::path path = std::filesystem::path(this->flags.output_dir) / output_name(this->flags, filename);
+        std::ofstream file(path);
+        file << result.output;
+        if (!file) {
+            std::cerr << "Unable to write output file: " << path.string() << std::endl;
+            result.failed = true;
+        }
+    }
+}
+
+bool Batch::print_results(std::ostream& out) const {
+    bool all_passed = true;
+    size_t width = 4;
+    for (const std::string& filename : this->flags.filenames) {
+        width = std::max(width, filename.size());
+    }
+
+    if (this->flags.output_dir == "") {
+        for (size_t i = 0; i < this->results.size(); i++) {
+            out << "==> " << this->flags.filenames[i] << " <==\n" << this->results[i].output;
+        }
+    }
+
+    std::string message = "BATCH SUMMARY:\n";
+    message += fmt::format("    {:<{}} {:>9} {:>9} {:>9} {:>10} {:>14} {:>16}\n",
+        "File", width, "Threads", "Elapsed", "Dispatch", "CPU util.", "Avg. response", "Avg. turnaround");
+
+    for (size_t i = 0; i < this->results.size(); i++) {
+        const BatchResult& result = this->results[i];
+        if (result.failed) {
+            message += fmt::format("    {:<{}} {:>9}\n", this->flags.filenames[i], width, "FAILED");
+            all_passed = false;
+            continue;
+        }
+
+        const SystemStats& stats = result.stats;
+        auto [threads, response, turnaround] = stats.overall_averages();
+
+        message += fmt::format("    {:<{}} {:>9} {:>9} {:>9} {:>9.2f}% {:>14.2f} {:>16.2f}\n",
+            this->flags.filenames[i], width, threads, stats.total_time, stats.dispatch_time,
+            stats.cpu_utilization, response, turnaround);
+    }
+
+    out << message << std::endl;
+    return all_passed;
+}
+
+std::string Batch::output_name(const FlagOptions& flags, const std::string& filename) {
+    std::string algorithm = flags.scheduler;
+    std::transform(algorithm.begin(), algorithm.end(), algorithm.begin(), ::tolower);
+
+    std::string test = std::filesystem::path(filename).filename().string();
+    if (test.rfind("input-", 0) == 0) {
+        test = test.substr(6);
+    }
+
+    std::string name = "output-" + algorithm;
+    if (flags.time_slice > 0) {
+        name += "-s" + std::to_string(flags.time_slice);
+    }
+    name += "-" + test;
+
+    std::string modes = "";
+    modes += flags.verbose ? "v" : "";
+    modes += flags.per_thread ? "t" : "";
+    modes += flags.metrics ? "m" : "";
+    if (modes != "") {
+        name += "." + modes;
+    }
+    return name;
+}
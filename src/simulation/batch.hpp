@@ -0,0 +1,108 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "types/system_stats/system_stats.hpp"
+
+#include "utilities/flags/flags.hpp"
+
+/*
+    Batch:
+        Simulates several files with the same flags, for example every file in a directory.
+        The files are independent, so they are simulated at the same time on a TaskRuntime
+        with --jobs workers. Each one's output is kept in its own buffer, so the outputs can
+        be printed in the order of the files, or written to --output_dir.
+*/
+
+class Batch {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        BatchResult:
+            What simulating one file produced: everything it printed, and its statistics.
+            failed is set if the file could not be simulated.
+    */
+    struct BatchResult {
+        std::string output;
+        SystemStats stats;
+        bool failed = false;
+    };
+
+    /*
+        flags:
+            The flags every file is simulated with. flags.filenames are the files.
+    */
+    FlagOptions flags;
+
+    /*
+        results:
+            The result of every file, in the same order as flags.filenames. Empty until
+            run().
+    */
+    std::vector<BatchResult> results;
+
+    /*
+        jobs:
+            How many files are simulated at the same time. Scheduler plugins may keep global
+            state, so with one, the files are simulated one at a time.
+    */
+    int jobs = 1;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        Batch(flags):
+            Prepares to simulate flags.filenames. With --output_dir, throws if two of the
+            files would be written to the same output file.
+    */
+    Batch(const FlagOptions& flags);
+
+    /*
+        run():
+            Simulates every file and, with --output_dir, writes its output there.
+    */
+    void run();
+
+    /*
+        print_results(out):
+            Prints each file's output, unless it was written to --output_dir, under a
+            "==> filename <==" line, and then a summary of every file:
+
+                BATCH SUMMARY:
+                    File                   Threads   Elapsed  Dispatch  CPU util.  Avg. response  Avg. turnaround
+                    tests/input/input-1         12      1320       238     97.12%          34.50           830.75
+
+            Returns false if any file failed.
+    */
+    bool print_results(std::ostream& out) const;
+
+    /*
+        output_name(flags, filename):
+            The name of the file in tests/output for simulating filename with the flags:
+
+                output-ALGORITHM[-sTIME_SLICE]-TEST[.MODES]
+
+            The test is the file's name without "input-", and the modes are v, t and m for
+            the -v, -t and -m flags that are set.
+    */
+    static std::string output_name(const FlagOptions& flags, const std::string& filename);
+
+private:
+
+    /*
+        simulate(index):
+            Simulates the file with the given index and stores its result.
+    */
+    void simulate(size_t index);
+};
+
+#endif
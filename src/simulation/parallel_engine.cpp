@@ -0,0 +1,286 @@
+#include "simulation/parallel_engine.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+#include "simulation/simulation.hpp"
+#include "utilities/task_runtime/task_runtime.hpp"
+
+ParallelEngine::ParallelEngine(Simulation& simulation, int workers) : simulation(simulation) {
+    // The engine handles the arrivals itself, so they leave the event queue before it is
+    // copied into the logical processes.
+    while (!simulation.events.empty()) {
+        this->arrivals.push_back(simulation.events.top());
+        simulation.events.pop();
+    }
+
+    // With one node, every process's home node is that one, which the cores would otherwise
+    // all set on their first dispatch.
+    for (const auto& entry : simulation.processes) {
+        entry.second->home_node = simulation.topology.node_of(0);
+    }
+
+    for (size_t i = 0; i < simulation.cores.size(); i++) {
+        this->partitions.push_back(std::make_unique<Simulation>(simulation));
+        this->marks.emplace_back();
+        mark(i, 0, 0);
+    }
+    this->partition_events.assign(this->partitions.size(), 0);
+    this->lookahead = std::max(0, std::min(simulation.thread_switch_overhead, simulation.process_switch_overhead));
+
+    this->workers = (workers > 0) ? workers : std::max(1u, std::thread::hardware_concurrency());
+    this->workers = std::min(this->workers, (int) this->partitions.size());
+}
+
+void ParallelEngine::run() {
+    TaskRuntime runtime(this->workers);
+
+    while (this->next_arrival < this->arrivals.size()) {
+        unsigned int time = this->arrivals[this->next_arrival]->time;
+
+        bool settled = true;
+        for (size_t i = 0; i < this->partitions.size() && settled; i++) {
+            settled = settled_before(i, time);
+        }
+
+        // Arrivals come before anything else at their time.
+        if (settled) {
+            for (size_t i = 0; i < this->partitions.size(); i++) {
+                advance_partition(i, time, 0);
+            }
+        } else {
+            advance(runtime, time, 0);
+        }
+        handle_arrivals();
+    }
+
+    advance(runtime, UINT_MAX, UINT_MAX);
+    pull_cores();
+    merge_statistics();
+    take_samples();
+}
+
+void ParallelEngine::advance(TaskRuntime& runtime, unsigned int time, unsigned int limit) {
+    // Only the logical processes with an event before the synchronization point have
+    // anything to do.
+    this->ready.clear();
+    for (size_t i = 0; i < this->partitions.size(); i++) {
+        const EventQueue& events = this->partitions[i]->events;
+        if (!events.empty() && (events.top()->time < time || (events.top()->time == time && events.top()->event_num <= limit))) {
+            this->ready.push_back(i);
+        }
+    }
+
+    if (this->ready.size() == 1) {
+        advance_partition(this->ready.front(), time, limit);
+    } else if (this->ready.size() > 1) {
+        runtime.parallel_for(this->ready.size(), [&](size_t i) {
+            advance_partition(this->ready[i], time, limit);
+        });
+        this->windows++;
+    }
+}
+
+void ParallelEngine::advance_partition(size_t index, unsigned int time, unsigned int limit) {
+    Simulation& partition = *this->partitions[index];
+
+    while (!partition.events.empty()) {
+        std::shared_ptr<Event> event = partition.events.top();
+        if (event->time > time || (event->time == time && event->event_num > limit)) {
+            return;
+        }
+        partition.events.pop();
+
+        // Events invalidated by a preemption never happen.
+        if (!event->cancelled) {
+            partition.arrivals.assign(1, event);
+            partition.handle_event(partition.arrivals);
+            this->partition_events[index]++;
+        }
+        mark(index, event->time, event->event_num);
+    }
+}
+
+bool ParallelEngine::settled_before(size_t index, unsigned int time) {
+    EventQueue& events = this->partitions[index]->events;
+    std::vector<std::shared_ptr<Event>> dispatches;
+
+    bool settled = true;
+    while (!events.empty() && events.top()->time < time) {
+        const std::shared_ptr<Event>& event = events.top();
+        if (event->type != DISPATCHER_INVOKED || event->time + this->lookahead < time) {
+            settled = false;
+            break;
+        }
+        dispatches.push_back(event);
+        events.pop();
+    }
+
+    for (const auto& event : dispatches) {
+        events.push(event);
+    }
+    return settled;
+}
+
+void ParallelEngine::mark(size_t index, unsigned int time, unsigned int event_num) {
+    const Simulation& partition = *this->partitions[index];
+    int load = partition.core_load(partition.cores[index]);
+    this->marks[index].push_back(Mark{time, event_num, partition.event_num, load, !partition.events.empty()});
+}
+
+void ParallelEngine::handle_arrivals() {
+    pull_cores();
+
+    unsigned int time = this->arrivals[this->next_arrival]->time;
+    this->simulation.arrivals.clear();
+    while (this->next_arrival < this->arrivals.size() && this->arrivals[this->next_arrival]->time == time) {
+        this->simulation.arrivals.push_back(this->arrivals[this->next_arrival]);
+        this->next_arrival++;
+    }
+    this->simulation.handle_event(this->simulation.arrivals);
+
+    // The dispatchers the arrivals invoked are numbered after every event their cores have
+    // created so far, as they would have been by the sequential engine.
+    while (!this->simulation.events.empty()) {
+        std::shared_ptr<Event> event = this->simulation.events.top();
+        this->simulation.events.pop();
+
+        Simulation& partition = *this->partitions[event->cpu];
+        partition.event_num++;
+        event->event_num = partition.event_num;
+        partition.add_event(event);
+        partition.cores[event->cpu].dispatch_pending = true;
+    }
+
+    // The arrivals come before any other event at their time.
+    unsigned int last = this->simulation.arrivals.back()->event_num;
+    for (size_t i = 0; i < this->partitions.size(); i++) {
+        mark(i, time, last);
+    }
+}
+
+void ParallelEngine::take_samples() {
+    // The sequential engine samples every interval from time 0 for as long as any arrivals
+    // or events are left. The events at a sample's time that the cores had created by the
+    // previous sample come before it (see Mark).
+    std::vector<size_t> current(this->partitions.size(), 0);
+    std::vector<unsigned int> limits;
+    for (const auto& partition_marks : this->marks) {
+        limits.push_back(partition_marks.front().last_event_num);
+    }
+
+    size_t arrival = 0;
+    unsigned int time = 0;
+    bool sampling = true;
+    while (sampling) {
+        while (arrival < this->arrivals.size() && this->arrivals[arrival]->time <= time) {
+            arrival++;
+        }
+        sampling = arrival < this->arrivals.size();
+
+        int lightest = INT_MAX, heaviest = INT_MIN;
+        for (size_t i = 0; i < this->partitions.size(); i++) {
+            const std::vector<Mark>& partition_marks = this->marks[i];
+            size_t& at = current[i];
+            while (at + 1 < partition_marks.size() && (partition_marks[at + 1].time < time || (partition_marks[at + 1].time == time && partition_marks[at + 1].event_num <= limits[i]))) {
+                at++;
+            }
+
+            const Mark& state = partition_marks[at];
+            lightest = std::min(lightest, state.load);
+            heaviest = std::max(heaviest, state.load);
+            sampling = sampling || state.pending;
+            limits[i] = state.last_event_num;
+        }
+        this->simulation.system_stats.imbalance_samples.emplace_back(time, heaviest - lightest);
+        time += this->simulation.flags.balance_interval;
+    }
+}
+
+void ParallelEngine::pull_cores() {
+    for (size_t i = 0; i < this->partitions.size(); i++) {
+        this->simulation.cores[i] = this->partitions[i]->cores[i];
+    }
+}
+
+void ParallelEngine::merge_statistics() {
+    SystemStats& stats = this->simulation.system_stats;
+
+    for (const auto& partition : this->partitions) {
+        const SystemStats& part = partition->system_stats;
+
+        stats.total_time = std::max(stats.total_time, part.total_time);
+        stats.dispatch_time += part.dispatch_time;
+        stats.service_time += part.service_time;
+        stats.io_time += part.io_time;
+        for (size_t i = 0; i < stats.core_service_times.size(); i++) {
+            stats.core_service_times[i] += part.core_service_times[i];
+            stats.core_dispatch_times[i] += part.core_dispatch_times[i];
+        }
+        for (size_t i = 0; i < stats.node_remote_dispatches.size(); i++) {
+            stats.node_remote_dispatches[i] += part.node_remote_dispatches[i];
+        }
+
+        for (int p = 0; p < 4; p++) {
+            stats.thread_counts[p] += part.thread_counts[p];
+            stats.avg_thread_response_times[p] += part.avg_thread_response_times[p];
+            stats.avg_thread_turnaround_times[p] += part.avg_thread_turnaround_times[p];
+            stats.max_thread_wait_times[p] = std::max(stats.max_thread_wait_times[p], part.max_thread_wait_times[p]);
+            stats.prediction_samples[p] += part.prediction_samples[p];
+            stats.prediction_error[p] += part.prediction_error[p];
+            stats.prediction_abs_error[p] += part.prediction_abs_error[p];
+            stats.prediction_squared_error[p] += part.prediction_squared_error[p];
+            stats.deadline_jobs[p] += part.deadline_jobs[p];
+            stats.deadline_misses[p] += part.deadline_misses[p];
+            stats.total_tardiness[p] += part.total_tardiness[p];
+        }
+        stats.lateness.insert(stats.lateness.end(), part.lateness.begin(), part.lateness.end());
+
+        stats.affinity_dispatches += part.affinity_dispatches;
+        stats.affinity_time_saved += part.affinity_time_saved;
+        stats.migrations += part.migrations;
+        stats.migration_time += part.migration_time;
+        stats.steal_attempts += part.steal_attempts;
+        stats.steals += part.steals;
+        stats.push_migrations += part.push_migrations;
+        stats.cross_node_migrations += part.cross_node_migrations;
+        stats.cross_node_migration_time += part.cross_node_migration_time;
+        stats.remote_dispatches += part.remote_dispatches;
+        stats.remote_dispatch_time += part.remote_dispatch_time;
+        stats.cpu_work += part.cpu_work;
+        stats.smt_contended_time += part.smt_contended_time;
+        stats.cache_refill_time += part.cache_refill_time;
+    }
+}
+
+bool ParallelEngine::same_statistics(const SystemStats& stats, const SystemStats& reference) {
+    for (int p = 0; p < 4; p++) {
+        if (stats.thread_counts[p] != reference.thread_counts[p]
+            || stats.avg_thread_response_times[p] != reference.avg_thread_response_times[p]
+            || stats.avg_thread_turnaround_times[p] != reference.avg_thread_turnaround_times[p]
+            || stats.max_thread_wait_times[p] != reference.max_thread_wait_times[p]
+            || stats.deadline_jobs[p] != reference.deadline_jobs[p]
+            || stats.deadline_misses[p] != reference.deadline_misses[p]
+            || stats.total_tardiness[p] != reference.total_tardiness[p]
+            || stats.lateness_percentiles[p] != reference.lateness_percentiles[p]) {
+            return false;
+        }
+    }
+
+    return stats.total_time == reference.total_time
+        && stats.dispatch_time == reference.dispatch_time
+        && stats.service_time == reference.service_time
+        && stats.io_time == reference.io_time
+        && stats.core_service_times == reference.core_service_times
+        && stats.core_dispatch_times == reference.core_dispatch_times
+        && stats.affinity_dispatches == reference.affinity_dispatches
+        && stats.migrations == reference.migrations
+        && stats.migration_time == reference.migration_time
+        && stats.imbalance_samples == reference.imbalance_samples
+        && stats.cpu_work == reference.cpu_work
+        && stats.cache_warm_hits == reference.cache_warm_hits
+        && stats.cache_cold_misses == reference.cache_cold_misses
+        && stats.cache_evictions == reference.cache_evictions
+        && stats.cache_refill_time == reference.cache_refill_time;
+}
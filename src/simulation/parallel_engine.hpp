@@ -0,0 +1,207 @@
+#ifndef PARALLEL_ENGINE_HPP
+#define PARALLEL_ENGINE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "types/event/event.hpp"
+#include "types/system_stats/system_stats.hpp"
+
+class Simulation;
+class TaskRuntime;
+
+/*
+    ParallelEngine:
+        Runs a simulation with per-CPU ready queues and no load balancing (--balance none) as
+        a conservative parallel discrete-event simulation. Each core is a logical process: a
+        copy of the simulation with its own event queue, event numbers and statistics, that
+        only ever handles the events of its own core and of the threads queued on it.
+
+        The cores only meet when threads arrive, since a thread is placed on the least loaded
+        core. The arrival times are in the simulation file, so up to the next one the logical
+        processes cannot affect each other and run in parallel on a TaskRuntime, in a window.
+        At its end the engine itself places the arrivals, with every core in the state the
+        sequential engine would have it.
+
+        A window is only needed if some core's load can change before the arrivals. A
+        dispatch only moves a thread from the core's queue onto the core, and what it starts
+        cannot end before the dispatch overhead (the smaller switch overhead) has passed. So
+        when every logical process has nothing but such dispatches before the next arrivals,
+        the engine handles them itself and places the arrivals without a window.
+
+        The imbalance samples only read the loads of the cores, so they need no window of
+        their own. Each logical process records the load of its core after every event (see
+        Mark), and the samples are taken from these records at the end.
+
+        Events at the same time are handled in the same order as by the sequential engine:
+        arrivals first, then the events created before the sample was, then the sample, then
+        the rest. So the results are exactly the same.
+
+        With a shared ready queue, or with stealing or pushing between the cores' queues,
+        every dispatch can depend on every other core's events up to that moment, so there is
+        no window in which the cores are independent. These runs are not split up. With one
+        CPU there is a single logical process, which the engine runs on the calling thread.
+*/
+
+class ParallelEngine {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        workers:
+            How many logical processes are simulated at the same time.
+    */
+    int workers = 1;
+
+    /*
+        windows:
+            How many times the logical processes were run in parallel.
+    */
+    size_t windows = 0;
+
+    /*
+        partition_events:
+            How many events each logical process handled, by core.
+    */
+    std::vector<size_t> partition_events;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        ParallelEngine(simulation, workers):
+            Splits the simulation, whose workload has been loaded, into one logical process
+            per core, to be simulated with the given number of workers (0 for one per hardware
+            thread, and at most one per core).
+    */
+    ParallelEngine(Simulation& simulation, int workers);
+
+    /*
+        run():
+            Runs the simulation to the end. Afterwards the simulation's cores and statistics
+            are the same as if it had run by itself.
+    */
+    void run();
+
+    /*
+        same_statistics(stats, reference):
+            Whether everything that the metrics show is the same in both statistics.
+    */
+    static bool same_statistics(const SystemStats& stats, const SystemStats& reference);
+
+private:
+
+    /*
+        simulation:
+            The simulation being run. The engine handles its arrivals and samples on it.
+    */
+    Simulation& simulation;
+
+    /*
+        partitions:
+            The logical processes, one per core, in the order of the cores.
+    */
+    std::vector<std::unique_ptr<Simulation>> partitions;
+
+    /*
+        arrivals, next_arrival:
+            The THREAD_ARRIVED events, in the order they are handled in, and the index of the
+            next one.
+    */
+    std::vector<std::shared_ptr<Event>> arrivals;
+    size_t next_arrival = 0;
+
+    /*
+        Mark:
+            The state of a logical process after it handled an event (or had arrivals placed
+            on its core) at the given time with the given number: the last event number it
+            had used, the load of its core, and whether it had events left.
+    */
+    struct Mark {
+        unsigned int time;
+        unsigned int event_num;
+        unsigned int last_event_num;
+        int load;
+        bool pending;
+    };
+
+    /*
+        marks:
+            For each logical process, its marks in the order of its events, starting with its
+            state before the first one.
+    */
+    std::vector<std::vector<Mark>> marks;
+
+    /*
+        lookahead:
+            The least time between a dispatch and the first event that can change the core's
+            load because of it: the smaller of the switch overheads.
+    */
+    unsigned int lookahead = 0;
+
+    /*
+        ready:
+            A reused buffer for the logical processes with events to handle in a window.
+    */
+    std::vector<size_t> ready;
+
+    /*
+        advance(runtime, time, limit):
+            Runs every logical process, in parallel, up to the given time: through each event
+            before it, and each event at it numbered up to the limit.
+    */
+    void advance(TaskRuntime& runtime, unsigned int time, unsigned int limit);
+
+    /*
+        advance_partition(index, time, limit):
+            Runs one logical process up to the given time and limit (see advance), and marks
+            its state after each event.
+    */
+    void advance_partition(size_t index, unsigned int time, unsigned int limit);
+
+    /*
+        settled_before(index, time):
+            Whether the load of the logical process's core cannot change before the given
+            time: its only events before then are dispatches at most the lookahead before it,
+            whose runs cannot end before that time.
+    */
+    bool settled_before(size_t index, unsigned int time);
+
+    /*
+        mark(index, time, event_num):
+            Records the state of a logical process at the given time and event number.
+    */
+    void mark(size_t index, unsigned int time, unsigned int event_num);
+
+    /*
+        handle_arrivals():
+            Handles the next arrivals, all those at the same time, and hands the events they
+            create to the cores they are for.
+    */
+    void handle_arrivals();
+
+    /*
+        take_samples():
+            Samples the imbalance between the cores, every --balance_interval ticks for as
+            long as anything else was going to happen, from the logical processes' marks.
+    */
+    void take_samples();
+
+    /*
+        pull_cores():
+            Copies the state of each core from its logical process into the simulation.
+    */
+    void pull_cores();
+
+    /*
+        merge_statistics():
+            Adds up the statistics of the logical processes into the simulation's.
+    */
+    void merge_statistics();
+};
+
+#endif
@@ -1,159 +1,446 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
 #include "algorithms/rr/rr_algorithm.hpp"
 #include "algorithms/priority/priority_algorithm.hpp"
+#include "algorithms/arr/arr_algorithm.hpp"
+#include "algorithms/edf/edf_algorithm.hpp"
+#include "algorithms/gang/gang_algorithm.hpp"
+#include "algorithms/hfs/hfs_algorithm.hpp"
+#include "algorithms/layered/layered_algorithm.hpp"
+#include "algorithms/psjf/psjf_algorithm.hpp"
 #include "algorithms/mlfq/mlfq_algorithm.hpp"
 #include "algorithms/custom/custom_algorithm.hpp"
+#include "algorithms/plugin/plugin_algorithm.hpp"
 
+#include "simulation/parallel_engine.hpp"
 #include "simulation/simulation.hpp"
 #include "types/enums.hpp"
 
 #include "utilities/flags/flags.hpp"
 
-Simulation::Simulation(FlagOptions flags) {
+Simulation::Simulation(FlagOptions flags, std::shared_ptr<const Workload> workload, std::ostream& out) {
     // Hello!
+    int class_cpus = 0;
+    for (const CoreClass& core_class : flags.core_classes) {
+        class_cpus += core_class.count;
+    }
+
+    if (flags.numa != "") {
+        this->read_topology(flags.numa);
+        if (class_cpus > 0 && class_cpus != this->topology.cpus()) {
+            std::cerr << "The core classes have " << class_cpus << " CPUs, but the topology has " << this->topology.cpus() << "." << std::endl;
+            throw(std::logic_error("Bad core classes."));
+        }
+        flags.cpus = this->topology.cpus();
+    } else {
+        if (class_cpus > 0) {
+            flags.cpus = class_cpus;
+        }
+        this->topology = Topology(1, flags.cpus);
+    }
+    this->flags = flags;
+    this->workload = workload;
+
+    // With SMT, every physical CPU is two cores (hardware threads) next to each other.
+    int threads_per_cpu = (flags.smt > 0.0) ? 2 : 1;
+    int core_count = flags.cpus * threads_per_cpu;
+    this->topology.cores_per_node *= threads_per_cpu;
+    this->core_classes = flags.core_classes;
+    for (CoreClass& core_class : this->core_classes) {
+        core_class.count *= threads_per_cpu;
+    }
+    this->logger = Logger(flags.verbose, flags.per_thread, flags.metrics, core_count, &out);
+
+    // With a load balancing policy, each core gets its own scheduler (ready queue).
+    for (int i = 0; i < core_count; i++) {
+        if (i == 0 || flags.balance != "") {
+            this->schedulers.push_back(create_scheduler(flags));
+        }
+        this->cores.emplace_back(i);
+        this->cores.back().scheduler = this->schedulers.back();
+        if (threads_per_cpu == 2) {
+            this->cores.back().sibling = i ^ 1;
+        }
+    }
+
+    // The cores are numbered class by class.
+    int id = 0;
+    if (!this->core_classes.empty()) {
+        this->fastest_speed = 0.0;
+    }
+    for (size_t i = 0; i < this->core_classes.size(); i++) {
+        for (int j = 0; j < this->core_classes[i].count; j++, id++) {
+            this->cores[id].core_class = i;
+            this->cores[id].speed = this->core_classes[i].speed;
+        }
+        this->fastest_speed = std::max(this->fastest_speed, this->core_classes[i].speed);
+    }
+    this->system_stats.core_service_times.resize(core_count, 0);
+    this->system_stats.core_dispatch_times.resize(core_count, 0);
+    this->system_stats.node_remote_dispatches.resize(this->topology.nodes, 0);
+}
+
+std::shared_ptr<Scheduler> Simulation::create_scheduler(const FlagOptions& flags) {
+    std::shared_ptr<Scheduler> scheduler;
     if (flags.scheduler == "FCFS") {
         // Create a FCFS scheduling algorithm
-        this->scheduler = std::make_shared<FCFSScheduler>();
+        scheduler = std::make_shared<FCFSScheduler>();
     } else if (flags.scheduler == "RR") {
         // Create a RR scheduling algorithm
-        this->scheduler = std::make_shared<RRScheduler>(flags.time_slice);
+        scheduler = std::make_shared<RRScheduler>(flags.time_slice);
     } else if (flags.scheduler == "PRIORITY") {
         // Create a PRIORITY scheduling algorithm
-        this->scheduler = std::make_shared<PRIORITYScheduler>();
+        scheduler = std::make_shared<PRIORITYScheduler>(-1, flags.preemptive, flags.aging_threshold);
+    } else if (flags.scheduler == "EDF") {
+        // Create an EDF scheduling algorithm
+        scheduler = std::make_shared<EDFScheduler>(-1, flags.preemptive);
+    } else if (flags.scheduler == "GANG") {
+        // Create a gang scheduling algorithm
+        scheduler = std::make_shared<GANGScheduler>(flags.time_slice, flags.process_quantum);
+    } else if (flags.scheduler == "ARR") {
+        // Create an adaptive round robin scheduling algorithm
+        scheduler = std::make_shared<ARRScheduler>(flags.time_slice, flags.overhead_target / 100.0);
+    } else if (flags.scheduler == "HFS") {
+        // Create a hierarchical fair-share scheduling algorithm
+        scheduler = std::make_shared<HFSScheduler>(flags.time_slice);
+    } else if (flags.scheduler == "PRIORITY_RR") {
+        // Create round robin within each priority level
+        scheduler = std::make_shared<Layered<PriorityLevels, RoundRobin>>(flags.time_slice);
+    } else if (flags.scheduler == "PRIORITY_CFS") {
+        // Create fair sharing between the threads of each priority level
+        scheduler = std::make_shared<Layered<PriorityLevels, FairShare>>(flags.time_slice);
+    } else if (flags.scheduler == "TENANT_RR") {
+        // Create fair sharing between groups, with round robin within each group
+        scheduler = std::make_shared<Layered<Tenants, RoundRobin>>(flags.time_slice);
+    } else if (flags.scheduler == "TENANT_CFS") {
+        // Create fair sharing between groups, and between the threads of each group
+        scheduler = std::make_shared<Layered<Tenants, FairShare>>(flags.time_slice);
+    } else if (flags.scheduler == "PSJF") {
+        // Create a predicted shortest-job-first scheduling algorithm
+        scheduler = std::make_shared<PSJFScheduler>();
     } else if (flags.scheduler == "MLFQ") {
         // Create a MLFQ scheduling algorithm
     } else if (flags.scheduler == "CUSTOM") {
         // Create a custom scheduling algorithm
+    } else if (flags.scheduler == "PLUGIN") {
+        // Load the scheduling algorithm from a shared object
+        scheduler = std::make_shared<PluginScheduler>(flags.scheduler_plugin, flags.time_slice);
     }
-    this->flags = flags;
-    this->logger = Logger(flags.verbose, flags.per_thread, flags.metrics);
+    if (scheduler != nullptr) {
+        scheduler->affinity_window = flags.affinity_window;
+    }
+    return scheduler;
 }
 
-void Simulation::run() {
-    this->read_file(this->flags.filename);
-    
-    while (!this->events.empty()) {
-        auto event = this->events.top();
-        this->events.pop();
+SystemStats Simulation::run() {
+    auto start = std::chrono::steady_clock::now();
+    this->simulate();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
-        // Invoke the appropriate method in the simulation for the given event type.
+    *this->logger.out << "SIMULATION COMPLETED!\n\n";
 
-        switch(event->type) {
-            case THREAD_ARRIVED:
-                this->handle_thread_arrived(event);
-                break;
+    for (auto entry: this->processes) {
+        this->logger.print_per_thread_metrics(entry.second);
+    }
 
-            case THREAD_DISPATCH_COMPLETED:
-            case PROCESS_DISPATCH_COMPLETED:
-                this->handle_dispatch_completed(event);
-                break;
+    SystemStats stats = this->calculate_statistics();
+    logger.print_simulation_metrics(stats);
+    logger.print_core_metrics(stats);
+    for (const auto& scheduler : this->schedulers) {
+        logger.print_scheduler_metrics(scheduler->metrics_summary());
+    }
 
-            case CPU_BURST_COMPLETED:
-                this->handle_cpu_burst_completed(event);
-                break;
+    if (this->flags.aging_threshold > 0) {
+        logger.print_wait_metrics(stats);
+    }
 
-            case IO_BURST_COMPLETED:
-                this->handle_io_burst_completed(event);
-                break;
-            case THREAD_COMPLETED:
-                this->handle_thread_completed(event);
-                break;
+    if (this->flags.scheduler == "PSJF") {
+        for (auto entry: this->processes) {
+            this->logger.print_prediction_metrics(entry.second);
+        }
+        logger.print_prediction_summary(stats);
+    }
 
-            case THREAD_PREEMPTED:
-                this->handle_thread_preempted(event);
-                break;
+    if (this->flags.affinity_window > 0) {
+        logger.print_affinity_metrics(stats);
+    }
 
-            case DISPATCHER_INVOKED:
-                this->handle_dispatcher_invoked(event);
-                break;
-        }
+    if (!stats.lateness.empty()) {
+        logger.print_deadline_metrics(stats);
+    }
+
+    if (this->flags.balance != "") {
+        logger.print_balance_metrics(stats, this->flags.balance);
+    }
+
+    if (this->flags.numa != "") {
+        logger.print_numa_metrics(stats, this->topology);
+    }
+
+    if (this->cores.front().cache != nullptr) {
+        logger.print_cache_metrics(stats);
+    }
 
-        // If this event triggered a state change, print it out.
-        if (event->thread && event->thread->current_state != event->thread->previous_state) {
-            this->logger.print_state_transition(event, event->thread->previous_state, event->thread->current_state);
+    // To show what the core classes change, the same workload is run again with every CPU
+    // at the reference speed.
+    if (!this->flags.core_classes.empty() && this->flags.metrics) {
+        FlagOptions reference_flags = this->flags;
+        reference_flags.verbose = false;
+        reference_flags.per_thread = false;
+        reference_flags.metrics = false;
+        reference_flags.core_classes.clear();
+        reference_flags.class_placement = "any";
+
+        Simulation reference(reference_flags, this->workload);
+        reference.simulate();
+        logger.print_class_metrics(stats, this->core_classes, reference.calculate_statistics());
+    }
+
+    // Likewise, to show what SMT changes, the same workload is run with it off.
+    if (this->flags.smt > 0.0 && this->flags.metrics) {
+        FlagOptions reference_flags = this->flags;
+        reference_flags.verbose = false;
+        reference_flags.per_thread = false;
+        reference_flags.metrics = false;
+        reference_flags.smt = 0.0;
+        reference_flags.smt_placement = "spread";
+
+        Simulation reference(reference_flags, this->workload);
+        reference.simulate();
+        logger.print_smt_metrics(stats, this->flags.smt, reference.calculate_statistics());
+    }
+
+    // With --pdes-verify, the parallel engine is checked, and timed, against the sequential
+    // one.
+    if (this->engine != nullptr && this->flags.metrics) {
+        double reference_seconds = -1.0;
+        bool same = false;
+        if (this->flags.pdes_verify) {
+            FlagOptions reference_flags = this->flags;
+            reference_flags.per_thread = false;
+            reference_flags.metrics = false;
+            reference_flags.pdes = false;
+            reference_flags.pdes_verify = false;
+
+            Simulation reference(reference_flags, this->workload);
+            start = std::chrono::steady_clock::now();
+            reference.simulate();
+            reference_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            same = ParallelEngine::same_statistics(stats, reference.calculate_statistics());
         }
-        this->system_stats.total_time = event->time;
-        event.reset();
+        logger.print_pdes_metrics(this->engine->workers, this->engine->windows, this->engine->partition_events, seconds, reference_seconds, same);
     }
-    // We are done!
+    return stats;
+}
 
-    std::cout << "SIMULATION COMPLETED!\n\n";
+void Simulation::simulate() {
+    this->load_workload();
 
-    for (auto entry: this->processes) {
-        this->logger.print_per_thread_metrics(entry.second);
+    // The parallel engine takes it from here, with the arrivals in the event queue.
+    if (this->flags.pdes) {
+        this->engine = std::make_shared<ParallelEngine>(*this, this->flags.jobs);
+        this->engine->run();
+        return;
     }
 
-    logger.print_simulation_metrics(this->calculate_statistics());
+    // Per-core ready queues are sampled, and balanced, from the start.
+    if (this->flags.balance != "") {
+        event_num++;
+        add_event(std::make_shared<Event>(LOAD_BALANCE, 0, event_num, nullptr));
+    }
+    
+    while (!this->events.empty()) {
+        auto event = this->events.top();
+        this->events.pop();
+
+        // Events invalidated by a preemption never happen.
+        if (event->cancelled) {
+            continue;
+        }
+
+        // Threads that arrive at the same time are handled as one batch. Arrivals are
+        // numbered before any other event, so they are next to each other in the queue.
+        this->arrivals.clear();
+        this->arrivals.push_back(event);
+        while (event->type == THREAD_ARRIVED && !this->events.empty() && this->events.top()->type == THREAD_ARRIVED && this->events.top()->time == event->time) {
+            this->arrivals.push_back(this->events.top());
+            this->events.pop();
+        }
+
+        // So are the dispatchers invoked at the same time on cores that share the ready
+        // queue, which can then take their threads in one pick.
+        bool shared = schedulers.size() == 1 && cores.size() > 1;
+        while (shared && event->type == DISPATCHER_INVOKED && !this->events.empty() && this->events.top()->type == DISPATCHER_INVOKED && this->events.top()->time == event->time) {
+            this->arrivals.push_back(this->events.top());
+            this->events.pop();
+        }
+
+        this->handle_event(this->arrivals);
+        event.reset();
+    }
+    // We are done!
 }
 
 //==============================================================================
 // Event-handling methods
 //==============================================================================
 
-void Simulation::handle_thread_arrived(const std::shared_ptr<Event> event) {
+void Simulation::handle_event(const std::vector<std::shared_ptr<Event>>& batch) {
+    const std::shared_ptr<Event>& event = batch.front();
 
-    event->thread->set_ready(event->time); //set thread to ready
-    event->thread->arrival_time = event->time; //set the arrival time of thread
-    scheduler->add_to_ready_queue(event->thread); //add the thread to the ready queue
+    if (event->cpu >= 0 && event == this->cores[event->cpu].active_event) {
+        this->cores[event->cpu].active_event = nullptr;
+        this->run_ended(this->cores[event->cpu], event->time);
+    }
 
-    if (active_thread == nullptr){
-        event_num++;
-        std::shared_ptr<Event> newDispatcherEvent = std::make_shared<Event>(DISPATCHER_INVOKED,event->time, event_num, nullptr, nullptr);
-        add_event(newDispatcherEvent);
+    // Invoke the appropriate method in the simulation for the given event type.
+
+    switch(event->type) {
+        case THREAD_ARRIVED:
+            this->handle_thread_arrived(batch);
+            break;
+
+        case THREAD_DISPATCH_COMPLETED:
+        case PROCESS_DISPATCH_COMPLETED:
+            this->handle_dispatch_completed(event);
+            break;
+
+        case CPU_BURST_COMPLETED:
+            this->handle_cpu_burst_completed(event);
+            break;
+
+        case IO_BURST_COMPLETED:
+            this->handle_io_burst_completed(event);
+            break;
+        case THREAD_COMPLETED:
+            this->handle_thread_completed(event);
+            break;
+
+        case THREAD_PREEMPTED:
+            this->handle_thread_preempted(event);
+            break;
+
+        case DISPATCHER_INVOKED:
+            this->handle_dispatcher_invoked(batch);
+            break;
+
+        case LOAD_BALANCE:
+            this->handle_load_balance(event);
+            return;
     }
 
+    // If these events triggered a state change, print it out.
+    for (const auto& handled : batch) {
+        if (handled->thread && handled->thread->current_state != handled->thread->previous_state) {
+            this->logger.print_state_transition(handled, handled->thread->previous_state, handled->thread->current_state);
+        }
+    }
+    this->system_stats.total_time = event->time;
+}
+
+void Simulation::handle_thread_arrived(const std::vector<std::shared_ptr<Event>>& events) {
+
+    this->arrived_threads.clear();
+    for (const auto& event : events) {
+        event->thread->set_ready(event->time); //set thread to ready
+        event->thread->arrival_time = event->time; //set the arrival time of thread
+        event->thread->release_next_burst(event->time); //start the deadline for the first CPU burst
+        this->arrived_threads.push_back(event->thread);
+    }
+    if (schedulers.size() > 1) {
+        for (const auto& thread : this->arrived_threads) {
+            queue_on_core(thread, events.front()->time);
+        }
+        preempt_if_needed(events.front()->time);
+        return;
+    }
+
+    schedulers.front()->add_many(this->arrived_threads); //add the threads to the ready queue
+
+    // Each arrival invokes the dispatcher on the next idle core. A single CPU wraps around
+    // and is invoked once per arrival.
+    int core = -1;
+    for (const auto& event : events) {
+        core = next_idle_core(core);
+        if (core != -1) {
+            invoke_dispatcher(event->time, core);
+        }
+    }
+
+    preempt_if_needed(events.front()->time);
 }
 void Simulation::handle_dispatch_completed(const std::shared_ptr<Event> event) {
-    
+    Core& core = cores[event->cpu];
+
     event->thread->set_running(event->time); //set thread to running
 
-    if(scheduler->time_slice > 0 && scheduler->time_slice < event->thread->get_next_burst(CPU)->length){
+    // The CPU burst stays at the front of the thread's queue until the run ends, so that
+    // a preemption can hand the unused part of it back.
+    auto burst = event->thread->get_next_burst(CPU);
+    int time_slice = event->scheduling_decision.time_slice;
+
+    // The burst's length is the work left at the reference speed. The core runs it at its
+    // own speed, slowed down while its SMT sibling is running too.
+    core.slowdown = sibling_running(core) ? flags.smt : 1.0;
+    double rate = core.speed / core.slowdown;
+    int work = burst->length;
+    int run_length = (int) std::ceil(work / rate - 1e-9);
+    core.slice_end = -1;
+
+    if(time_slice > 0 && time_slice < run_length){
 
         event_num++; //increment event_num
-        std::shared_ptr<Event> newThreadEvent = std::make_shared<Event>(THREAD_PREEMPTED, event->time + scheduler->time_slice, event_num, event->thread, nullptr);
-        add_event(newThreadEvent); // add event to the queue
-        event->thread->get_next_burst(BurstType::CPU)->length -= scheduler->time_slice; // update time slice
-        system_stats.service_time += scheduler->time_slice; //update system service time
-        event->thread->service_time += scheduler->time_slice; //update thread service time
-    }else{
+        run_length = time_slice;
+        work = std::max(1, (int) (time_slice * rate + 1e-9));
+        core.slice_end = event->time + run_length;
+        core.active_event = std::make_shared<Event>(THREAD_PREEMPTED, event->time + run_length, event_num, event->thread);
+    }else if(event->thread->bursts.size() <= 1){
 
-        if(event->thread->bursts.size() <= 1){
         event_num++;
-        std::shared_ptr<Event> newThreadEvent = std::make_shared<Event>(THREAD_COMPLETED,event->time + event->thread->get_next_burst(CPU)->length, event_num, event->thread, nullptr);
-        system_stats.service_time += event->thread->get_next_burst(BurstType::CPU)->length; //update system service time
-        event->thread->service_time += event->thread->get_next_burst(BurstType::CPU)->length;  //update thread service time
-        add_event(newThreadEvent); // add event to the queue
-        event->thread->pop_next_burst(CPU); // POP!!
-        
-        }
-        else if (event->thread->bursts.size() > 1){
-    
+        core.active_event = std::make_shared<Event>(THREAD_COMPLETED, event->time + run_length, event_num, event->thread);
+    }else{
+
         event_num++;
-        std::shared_ptr<Event> newCPUEvent = std::make_shared<Event>(CPU_BURST_COMPLETED, event->thread->get_next_burst(CPU)->length + event->time,event_num, event->thread, nullptr);
-        system_stats.service_time += event->thread->get_next_burst(BurstType::CPU)->length; //update system service time
-        event->thread->service_time += event->thread->get_next_burst(BurstType::CPU)->length; //update thread service time
-        event->thread->pop_next_burst(CPU);       // POP!!!       
-        add_event(newCPUEvent);  // add event to the queue 
-        }
-    }    
+        core.active_event = std::make_shared<Event>(CPU_BURST_COMPLETED, event->time + run_length, event_num, event->thread);
+    }
+    core.active_event->cpu = core.id;
+
+    burst->length -= work; // update the remaining burst time
+    core.run_work = work;
+    core.work_done = 0.0;
+    core.rate_since = event->time;
+    system_stats.service_time += run_length; //update system service time
+    system_stats.core_service_times[core.id] += run_length; //update core service time
+    event->thread->service_time += run_length; //update thread service time
+    add_event(core.active_event); // add event to the queue
+
+    // The sibling has to share the CPU from now on.
+    if (core.sibling != -1) {
+        retime_run(cores[core.sibling], event->time);
+    }
+
+    preempt_if_needed(event->time);
 }
 
 void Simulation::handle_cpu_burst_completed(const std::shared_ptr<Event> event) {
     
+    cores[event->cpu].busy = false;
+    complete_cpu_burst(event->thread, event->time, event->cpu); // POP!!
+
     if(!event->thread->bursts.empty()){ //make sure queue isnt empty
         event->thread->set_blocked(event->time); //set thread to blocked!
-       
-        
-        event_num++;
-        std::shared_ptr<Event> newDispatcherEvent = std::make_shared<Event>(DISPATCHER_INVOKED,event->time,event_num, nullptr, nullptr);
-        add_event(newDispatcherEvent); // add event to the queue
-       
+
+        invoke_dispatcher(event->time, event->cpu);
 
         event_num++;
-        std::shared_ptr<Event> newIOEvent = std::make_shared<Event>(IO_BURST_COMPLETED, event->thread->get_next_burst(IO)->length + event->time,event_num, event->thread, nullptr);
+        std::shared_ptr<Event> newIOEvent = std::make_shared<Event>(IO_BURST_COMPLETED, event->thread->get_next_burst(IO)->length + event->time,event_num, event->thread);
         system_stats.io_time += event->thread->get_next_burst(IO)->length; //update system io time
         event->thread->io_time += event->thread->get_next_burst(IO)->length;  //update thread io time 
         event->thread->pop_next_burst(IO);  // POP!!!
@@ -164,23 +451,25 @@ void Simulation::handle_cpu_burst_completed(const std::shared_ptr<Event> event)
 
 void Simulation::handle_io_burst_completed(const std::shared_ptr<Event> event) {
     
-    event->thread->set_ready(event->type); // set thread to ready after IO burst
-    scheduler->add_to_ready_queue(event->thread); // add thread to the ready queue
-    
-    if(active_thread == nullptr){
-        event_num++;
-        std::shared_ptr<Event> newDispatcherEvent = std::make_shared<Event>(DISPATCHER_INVOKED, event->time, event_num, nullptr, nullptr);
-        add_event(newDispatcherEvent);
-
+    event->thread->set_ready(event->time); // set thread to ready after IO burst
+    event->thread->release_next_burst(event->time); // start the deadline for the next CPU burst
+    if (schedulers.size() > 1) {
+        queue_on_core(event->thread, event->time);
+    } else {
+        schedulers.front()->add_to_ready_queue(event->thread); // add thread to the ready queue
+
+        int core = next_idle_core(-1);
+        if (core != -1) {
+            invoke_dispatcher(event->time, core);
+        }
     }
 
-    
-
- 
+    preempt_if_needed(event->time);
 }
 
 void Simulation::handle_thread_completed(const std::shared_ptr<Event> event) {
-
+    cores[event->cpu].busy = false;
+    complete_cpu_burst(event->thread, event->time, event->cpu); // POP!!
     event->thread->set_finished(event->time); // set the thread to finished
     //prev_thread = active_thread;
     //active_thread = nullptr; //set the active thread to = nullptr leaving the CPU idel
@@ -190,58 +479,585 @@ void Simulation::handle_thread_completed(const std::shared_ptr<Event> event) {
     system_stats.avg_thread_response_times[event->thread->priority] += event->thread->start_time - event->thread->arrival_time; //update response time
     system_stats.avg_thread_turnaround_times[event->thread->priority] += event->thread->end_time - event->thread->arrival_time; //update turnaround time
 
-    event_num++;
-    std::shared_ptr<Event> newDispatcherEvent = std::make_shared<Event>(DISPATCHER_INVOKED, event->time, event_num, nullptr, nullptr);
-    add_event(newDispatcherEvent);
-     
+    invoke_dispatcher(event->time, event->cpu);
 }
 
 void Simulation::handle_thread_preempted(const std::shared_ptr<Event> event) {
+    cores[event->cpu].busy = false;
     event->thread->set_ready(event->time);
-    scheduler->add_to_ready_queue(event->thread);
+    cores[event->cpu].scheduler->add_to_ready_queue(event->thread);
 
-    event_num++;
-    std::shared_ptr<Event> newDispatcherEvent = std::make_shared<Event>(DISPATCHER_INVOKED, event->time, event_num, nullptr, nullptr);
-    add_event(newDispatcherEvent);
-           
+    invoke_dispatcher(event->time, event->cpu);
 }
 
-void Simulation::handle_dispatcher_invoked(const std::shared_ptr<Event> event) {
+void Simulation::handle_dispatcher_invoked(const std::vector<std::shared_ptr<Event>>& events) {
+    this->dispatches.clear();
+    for (const auto& event : events) {
+        // A wake-up can be cancelled by a dispatch earlier in the batch.
+        if (event->cancelled) {
+            continue;
+        }
+        Core& core = cores[event->cpu];
+
+        // A core that is already dispatching or running a thread has nothing to do. A single
+        // CPU has always dispatched anyway when threads arrive together, and still does so
+        // that its output does not change.
+        core.dispatch_pending = false;
+        if (core.busy && cores.size() > 1) {
+            continue;
+        }
+        bool dispatching = false;
+        for (const auto& other : this->dispatches) {
+            dispatching = dispatching || other->cpu == event->cpu;
+        }
+        if (dispatching) {
+            continue;
+        }
+
+        // A dispatch makes any pending wake-up unnecessary.
+        if (core.wakeup_event != nullptr && core.wakeup_event != event) {
+            core.wakeup_event->cancelled = true;
+        }
+        core.wakeup_event = nullptr;
+        this->dispatches.push_back(event);
+    }
+
+    // The process of the thread that last ran on each core, which FIFO queues may prefer
+    // (see Scheduler::affinity_process_id). A core that has never run one keeps the last.
+    Scheduler& scheduler = *cores[this->dispatches.empty() ? 0 : this->dispatches.front()->cpu].scheduler;
+    int affinity = scheduler.affinity_process_id;
+    auto affinity_of = [&](const Core& core) {
+        if (core.active_thread != nullptr) {
+            affinity = core.active_thread->process_id;
+        } else if (core.prev_thread != nullptr) {
+            affinity = core.prev_thread->process_id;
+        }
+        return affinity;
+    };
+
+    // Cores that share the ready queue take their threads in one pick, unless the picks
+    // could depend on which core asks.
+    bool together = this->dispatches.size() > 1;
+    int first = together ? affinity_of(cores[this->dispatches.front()->cpu]) : -1;
+    for (size_t i = 1; i < this->dispatches.size() && together; i++) {
+        together = affinity_of(cores[this->dispatches[i]->cpu]) == first;
+    }
 
-    std::shared_ptr<SchedulingDecision> NewThread = scheduler->get_next_thread(); 
+    if (together) {
+        scheduler.current_time = this->dispatches.front()->time;
+        scheduler.affinity_process_id = first;
+        this->decisions.clear();
+        scheduler.pick_up_to(this->dispatches.size(), this->decisions);
+        this->decisions.resize(this->dispatches.size());
 
-    if(active_thread != nullptr){ //Is the CPU idle???
-        prev_thread = active_thread;
+        for (size_t i = 0; i < this->dispatches.size(); i++) {
+            dispatch(cores[this->dispatches[i]->cpu], this->dispatches[i], std::move(this->decisions[i]));
+        }
+        return;
     }
 
-    if(NewThread == nullptr){
-        active_thread = nullptr;
+    for (const auto& event : this->dispatches) {
+        Core& core = cores[event->cpu];
+        Scheduler& scheduler = *core.scheduler;
+        scheduler.current_time = event->time;
+        if (core.active_thread != nullptr) {
+            scheduler.affinity_process_id = core.active_thread->process_id;
+        } else if (core.prev_thread != nullptr) {
+            scheduler.affinity_process_id = core.prev_thread->process_id;
+        }
+        SchedulingDecision decision = scheduler.get_next_thread();
+
+        // A core whose own queue is empty may take a thread from another core's.
+        if (decision.thread == nullptr && steal_thread(core, event->time)) {
+            decision = scheduler.get_next_thread();
+        }
+        dispatch(core, event, std::move(decision));
+    }
+}
+
+void Simulation::dispatch(Core& core, const std::shared_ptr<Event>& event, SchedulingDecision decision) {
+    Scheduler& scheduler = *core.scheduler;
+
+    if(core.active_thread != nullptr){ //Is the CPU idle???
+        core.prev_thread = core.active_thread;
+    }
+
+    if(decision.thread == nullptr){
+        core.active_thread = nullptr;
+
+        // Come back when the scheduler has a thread that can run.
+        int wakeup_time = scheduler.next_wakeup_time();
+        if (wakeup_time > (int) event->time) {
+            core.wakeup_event = invoke_dispatcher(wakeup_time, core.id);
+            core.dispatch_pending = false;
+        }
         return;
     }
       
-    if(prev_thread == nullptr || prev_thread->process_id !=NewThread->thread->process_id){
+    core.active_thread = decision.thread;
+    core.busy = true;
+
+    // A thread that last ran on another core pays to bring its state over, and more if
+    // that core is on another node.
+    int extra = 0;
+    int last_cpu = core.active_thread->last_cpu;
+    int node = topology.node_of(core.id);
+    if (last_cpu != -1 && last_cpu != core.id) {
+        extra = flags.migration_cost;
+        if (topology.node_of(last_cpu) != node) {
+            extra += topology.migration_penalty;
+            system_stats.cross_node_migrations++;
+            system_stats.cross_node_migration_time += topology.migration_penalty;
+        }
+        system_stats.migrations++;
+        system_stats.migration_time += extra;
+    }
+    core.active_thread->last_cpu = core.id;
+
+    // A thread away from its process's home node reaches its memory remotely.
+    Process& process = *processes[core.active_thread->process_id];
+    if (process.home_node == -1) {
+        process.home_node = node;
+    }
+    if (process.home_node != node) {
+        extra += topology.remote_penalty;
+        system_stats.remote_dispatches++;
+        system_stats.remote_dispatch_time += topology.remote_penalty;
+        system_stats.node_remote_dispatches[node]++;
+    }
+
+    // With the cache model, the process also pays to warm the core's caches back up.
+    if (core.cache != nullptr) {
+        int refill = core.cache->switch_cost(core.active_thread->process_id, event->time);
+        extra += refill;
+        system_stats.cache_refill_time += refill;
+    }
+
+    // The decision moves into the dispatch event, which keeps it for logging.
+    std::shared_ptr<Event> dispatchEvent;
+    int overhead;
+    if(core.prev_thread == nullptr || core.prev_thread->process_id != core.active_thread->process_id){
         event_num++;
-        std::shared_ptr<Event> newDispatcherEvent = std::make_shared<Event>(PROCESS_DISPATCH_COMPLETED,event->time + process_switch_overhead,event_num, NewThread->thread, NewThread);
-        add_event(newDispatcherEvent);  // add event to queue
-        system_stats.dispatch_time += process_switch_overhead; //update the dispatcher time on system
+        overhead = process_switch_overhead + extra;
+        dispatchEvent = std::make_shared<Event>(PROCESS_DISPATCH_COMPLETED,event->time + overhead,event_num, core.active_thread, std::move(decision));
     }else{
         event_num++;
-        std::shared_ptr<Event> newThreadEvent = std::make_shared<Event>(THREAD_DISPATCH_COMPLETED, event->time + thread_switch_overhead, event_num,NewThread->thread, NewThread);
-        add_event(newThreadEvent); // add event to the queue
-        system_stats.dispatch_time += thread_switch_overhead; //update system dispatch time
+        overhead = thread_switch_overhead + extra;
+        dispatchEvent = std::make_shared<Event>(THREAD_DISPATCH_COMPLETED, event->time + overhead, event_num, core.active_thread, std::move(decision));
+
+        // Without affinity the head of the queue would have caused a process switch.
+        if (dispatchEvent->scheduling_decision.affinity_hit) {
+            system_stats.affinity_dispatches++;
+            system_stats.affinity_time_saved += process_switch_overhead - thread_switch_overhead;
         }
-        
-    active_thread = NewThread->thread;
+    }
+    dispatchEvent->cpu = core.id;
+    add_event(dispatchEvent); // add event to the queue
+    system_stats.dispatch_time += overhead; //update system dispatch time
+    system_stats.core_dispatch_times[core.id] += overhead; //update core dispatch time
+
+    // The thread has been waiting in the ready queue since its last state change.
+    size_t wait_time = event->time - core.active_thread->state_change_time;
+    if (wait_time > system_stats.max_thread_wait_times[core.active_thread->priority]) {
+        system_stats.max_thread_wait_times[core.active_thread->priority] = wait_time;
+    }
 
-    this->logger.print_verbose(event,active_thread, NewThread->explanation); //seg fault when added
+    this->logger.print_scheduling_decision(event, dispatchEvent->scheduling_decision);
+}
 
-    
+void Simulation::handle_load_balance(const std::shared_ptr<Event> event) {
+    std::vector<int> loads;
+    for (const Core& core : cores) {
+        loads.push_back(core_load(core));
+    }
+    auto [lightest, heaviest] = std::minmax_element(loads.begin(), loads.end());
+    system_stats.imbalance_samples.emplace_back(event->time, *heaviest - *lightest);
+
+    // Push migration. NUMA-aware placements balance within each node first.
+    if (flags.balance == "push" || flags.balance == "both") {
+        if (flags.placement != "spread") {
+            for (int node = 0; node < topology.nodes; node++) {
+                push_threads(loads, node * topology.cores_per_node, (node + 1) * topology.cores_per_node, event->time);
+            }
+        }
+        if (flags.placement != "strict") {
+            push_threads(loads, 0, cores.size(), event->time);
+        }
+    }
+
+    // Keep sampling for as long as anything else is going to happen.
+    if (!events.empty()) {
+        event_num++;
+        add_event(std::make_shared<Event>(LOAD_BALANCE, event->time + flags.balance_interval, event_num, nullptr));
+    }
 }
 
 //==============================================================================
 // Utility methods
 //==============================================================================
 
+void Simulation::push_threads(std::vector<int>& loads, int first, int last, unsigned int time) {
+    // Each move can only lower the imbalance, so this ends.
+    int count = last - first;
+    for (int moves = 0; moves < count * count; moves++) {
+        int to = std::min_element(loads.begin() + first, loads.begin() + last) - loads.begin();
+        int from = -1;
+        for (int i = first; i < last; i++) {
+            if (cores[i].scheduler->size() > 0 && (from == -1 || loads[i] > loads[from])) {
+                from = i;
+            }
+        }
+        if (from == -1 || loads[from] - loads[to] <= 1) {
+            return;
+        }
+
+        cores[from].scheduler->current_time = time;
+        std::shared_ptr<Thread> thread = cores[from].scheduler->take_for_migration();
+        if (thread == nullptr) {
+            return;
+        }
+        cores[to].scheduler->add_to_ready_queue(thread);
+        system_stats.push_migrations++;
+        loads[from]--;
+        loads[to]++;
+
+        if (core_idle(cores[to])) {
+            invoke_dispatcher(time, to);
+        }
+    }
+}
+
+void Simulation::preempt_if_needed(unsigned int time) {
+    // Every core has the same algorithm, so asking one is enough.
+    if (!schedulers.front()->is_preemptive()) {
+        return;
+    }
+
+    // A thread that became ready while a core is idle will run there instead, if that core
+    // can take it. Each idle core, even one already about to dispatch, takes one ready
+    // thread, so only threads beyond those can take a core from its thread.
+    bool shared = schedulers.size() == 1;
+    bool steals = flags.balance == "steal" || flags.balance == "both";
+    if (shared || steals) {
+        size_t ready = 0, idle = 0;
+        for (const auto& scheduler : schedulers) {
+            ready += scheduler->size();
+        }
+        for (const Core& core : cores) {
+            idle += (core.active_thread == nullptr) ? 1 : 0;
+        }
+        if (idle > 0 && ready <= idle) {
+            return;
+        }
+    }
+
+    for (Core& core : cores) {
+        if (core.active_event == nullptr || core.active_event->time <= time || !core.scheduler->should_preempt(core.active_thread)) {
+            continue;
+        }
+
+        // Hand the part of the burst the thread will no longer run back to it.
+        int unused = core.active_event->time - time;
+        int done = std::min(core.run_work, (int) (core.work_done + (time - core.rate_since) * core.speed / core.slowdown + 1e-9));
+        core.active_thread->get_next_burst(CPU)->length += core.run_work - done;
+        core.active_thread->service_time -= unused;
+        system_stats.service_time -= unused;
+        system_stats.core_service_times[core.id] -= unused;
+
+        core.active_event->cancelled = true;
+        core.active_event = nullptr;
+        run_ended(core, time);
+
+        event_num++;
+        std::shared_ptr<Event> newPreemptedEvent = std::make_shared<Event>(THREAD_PREEMPTED, time, event_num, core.active_thread);
+        newPreemptedEvent->cpu = core.id;
+        add_event(newPreemptedEvent);
+        return;
+    }
+}
+
+std::shared_ptr<Event> Simulation::invoke_dispatcher(unsigned int time, int cpu) {
+    event_num++;
+    std::shared_ptr<Event> newDispatcherEvent = std::make_shared<Event>(DISPATCHER_INVOKED, time, event_num, nullptr);
+    newDispatcherEvent->cpu = cpu;
+    cores[cpu].dispatch_pending = true;
+    add_event(newDispatcherEvent);
+    return newDispatcherEvent;
+}
+
+void Simulation::queue_on_core(std::shared_ptr<Thread> thread, unsigned int time) {
+    int target = (thread->last_cpu != -1) ? thread->last_cpu : least_loaded_core();
+
+    // NUMA-aware placements keep the thread on its process's home node, which is chosen when
+    // the process's first thread is placed.
+    int node = -1;
+    if (flags.placement != "spread") {
+        Process& process = *processes[thread->process_id];
+        if (process.home_node == -1) {
+            process.home_node = topology.node_of(target);
+        }
+        node = process.home_node;
+    }
+
+    // Placement by core class, within the node. If the node has no core of the wanted
+    // class, any core on it will do.
+    int fast = preferred_class(*thread, time);
+
+    // With SMT isolation, also away from a sibling running another process.
+    int process_id = (flags.smt_placement == "isolate") ? thread->process_id : -1;
+    if (!core_matches(cores[target], node, fast, process_id)) {
+        target = least_loaded_core(node, fast, process_id);
+        if (target == -1) {
+            target = least_loaded_core(node, fast);
+        }
+        if (target == -1) {
+            target = least_loaded_core(node);
+        }
+    }
+    cores[target].scheduler->add_to_ready_queue(thread);
+
+    if (core_idle(cores[target])) {
+        invoke_dispatcher(time, target);
+        return;
+    }
+
+    // An idle core can come and take the thread, if it is allowed to. A core that is
+    // already about to dispatch only takes one thread, so it is not asked again.
+    if (flags.balance != "steal" && flags.balance != "both") {
+        return;
+    }
+    for (const Core& core : cores) {
+        if (core_idle(core) && (flags.placement != "strict" || topology.node_of(core.id) == topology.node_of(target))) {
+            invoke_dispatcher(time, core.id);
+            return;
+        }
+    }
+}
+
+bool Simulation::steal_thread(Core& core, unsigned int time) {
+    if (flags.balance != "steal" && flags.balance != "both") {
+        return false;
+    }
+    system_stats.steal_attempts++;
+
+    // The victim is the core with the longest queue. NUMA-aware placements look on the
+    // core's own node first, and only "local" looks further.
+    auto longest_queue = [&](bool same_node) {
+        Core* victim = nullptr;
+        for (Core& other : cores) {
+            if (&other == &core || other.scheduler->size() == 0) {
+                continue;
+            }
+            if (same_node && topology.node_of(other.id) != topology.node_of(core.id)) {
+                continue;
+            }
+            if (victim == nullptr || other.scheduler->size() > victim->scheduler->size()) {
+                victim = &other;
+            }
+        }
+        return victim;
+    };
+
+    Core* victim = longest_queue(flags.placement != "spread");
+    if (victim == nullptr && flags.placement == "local") {
+        victim = longest_queue(false);
+    }
+    if (victim == nullptr) {
+        return false;
+    }
+
+    victim->scheduler->current_time = time;
+    std::shared_ptr<Thread> thread = victim->scheduler->take_for_migration();
+    if (thread == nullptr) {
+        return false;
+    }
+    core.scheduler->add_to_ready_queue(thread);
+    system_stats.steals++;
+    return true;
+}
+
+int Simulation::core_load(const Core& core) const {
+    return core.scheduler->size() + (core.busy ? 1 : 0);
+}
+
+int Simulation::least_loaded_core(int node, int fast, int process_id) const {
+    // With SMT, ties go to the core whose sibling is less loaded.
+    auto load = [&](const Core& core) {
+        int sibling_load = (core.sibling != -1) ? core_load(cores[core.sibling]) : 0;
+        return std::make_pair(core_load(core), sibling_load);
+    };
+
+    int best = -1;
+    for (const Core& core : cores) {
+        if (core_matches(core, node, fast, process_id) && (best == -1 || load(core) < load(cores[best]))) {
+            best = core.id;
+        }
+    }
+    return best;
+}
+
+bool Simulation::core_matches(const Core& core, int node, int fast, int process_id) const {
+    if (node != -1 && topology.node_of(core.id) != node) {
+        return false;
+    }
+    if (fast != -1 && (core.speed >= fastest_speed) != (fast == 1)) {
+        return false;
+    }
+    if (process_id != -1 && core.sibling != -1) {
+        const Core& sibling = cores[core.sibling];
+        return sibling.active_thread == nullptr || sibling.active_thread->process_id == process_id;
+    }
+    return true;
+}
+
+bool Simulation::sibling_running(const Core& core) const {
+    return core.sibling != -1 && cores[core.sibling].active_event != nullptr;
+}
+
+void Simulation::retime_run(Core& core, unsigned int time) {
+    // Nothing changes if the core is not running a thread, or its run ends now anyway.
+    double slowdown = sibling_running(core) ? flags.smt : 1.0;
+    if (core.active_event == nullptr || core.active_event->time <= time || slowdown == core.slowdown) {
+        return;
+    }
+
+    // Bank the work done at the old rate.
+    if (core.slowdown > 1.0) {
+        system_stats.smt_contended_time += time - core.rate_since;
+    }
+    core.work_done += (time - core.rate_since) * core.speed / core.slowdown;
+    core.rate_since = time;
+    core.slowdown = slowdown;
+    double rate = core.speed / slowdown;
+
+    // The run now ends when the rest of the burst is done at the new rate, or when its
+    // time slice ends if that is sooner.
+    std::shared_ptr<Thread> thread = core.active_thread;
+    auto burst = thread->get_next_burst(CPU);
+    int total = burst->length + core.run_work;
+    unsigned int end = time + (int) std::ceil((total - core.work_done) / rate - 1e-9);
+    EventType type = (thread->bursts.size() <= 1) ? THREAD_COMPLETED : CPU_BURST_COMPLETED;
+    int work = total;
+
+    if (core.slice_end != -1 && (unsigned int) core.slice_end < end) {
+        end = core.slice_end;
+        type = THREAD_PREEMPTED;
+
+        // Like a fresh run, a slowed-down one always makes some progress, or two siblings
+        // could keep preempting each other's threads before either gets anywhere.
+        work = std::max(1, (int) (core.work_done + (end - time) * rate + 1e-9));
+        if (work >= total) {
+            work = total;
+            type = (thread->bursts.size() <= 1) ? THREAD_COMPLETED : CPU_BURST_COMPLETED;
+        }
+    }
+
+    int change = (int) end - (int) core.active_event->time;
+    thread->service_time += change;
+    system_stats.service_time += change;
+    system_stats.core_service_times[core.id] += change;
+    burst->length = total - work;
+    core.run_work = work;
+
+    if (end != core.active_event->time || type != core.active_event->type) {
+        core.active_event->cancelled = true;
+
+        event_num++;
+        core.active_event = std::make_shared<Event>(type, end, event_num, thread);
+        core.active_event->cpu = core.id;
+        add_event(core.active_event);
+    }
+}
+
+void Simulation::run_ended(Core& core, unsigned int time) {
+    if (core.cache != nullptr) {
+        core.cache->touch(core.active_thread->process_id, time);
+    }
+
+    if (core.slowdown > 1.0) {
+        system_stats.smt_contended_time += time - core.rate_since;
+    }
+    core.slowdown = 1.0;
+
+    // The sibling has the CPU to itself again.
+    if (core.sibling != -1) {
+        retime_run(cores[core.sibling], time);
+    }
+}
+
+int Simulation::preferred_class(const Thread& thread, unsigned int time) const {
+    if (flags.class_placement == "priority") {
+        return (thread.priority == SYSTEM || thread.priority == INTERACTIVE) ? 1 : 0;
+    }
+
+    if (flags.class_placement == "utilization") {
+        // Threads start on the slower cores, and move up once they have been running for
+        // at least half the time since they arrived.
+        int lifetime = (int) time - thread.arrival_time;
+        return (lifetime > 0 && 2 * thread.service_time >= lifetime) ? 1 : 0;
+    }
+    return -1;
+}
+
+int Simulation::next_idle_core(int after) const {
+    int count = cores.size();
+
+    // With SMT, a core whose sibling is idle too comes first.
+    for (int i = 1; i <= count && cores[0].sibling != -1; i++) {
+        int core = (after + i) % count;
+        if (core_idle(cores[core]) && core_idle(cores[cores[core].sibling])) {
+            return core;
+        }
+    }
+
+    for (int i = 1; i <= count; i++) {
+        int core = (after + i) % count;
+        if (core_idle(cores[core])) {
+            return core;
+        }
+    }
+    return -1;
+}
+
+bool Simulation::core_idle(const Core& core) const {
+    // A single CPU has always been invoked again while its dispatch was pending, and still
+    // is so that its output does not change.
+    return core.active_thread == nullptr && (!core.dispatch_pending || cores.size() == 1);
+}
+
+void Simulation::complete_cpu_burst(std::shared_ptr<Thread> thread, unsigned int time, int cpu) {
+    int length = thread->get_next_burst(CPU)->initial_length;
+    system_stats.cpu_work += length;
+
+    record_deadline(thread, time);
+
+    // Check the thread's prediction for this burst before the predictor learns from it.
+    double error = length - thread->predictor.predict();
+    system_stats.prediction_samples[thread->priority]++;
+    system_stats.prediction_error[thread->priority] += error;
+    system_stats.prediction_abs_error[thread->priority] += std::fabs(error);
+    system_stats.prediction_squared_error[thread->priority] += error * error;
+    thread->predictor.observe(length);
+
+    cores[cpu].scheduler->cpu_burst_completed(thread, length);
+    thread->pop_next_burst(CPU);
+}
+
+void Simulation::record_deadline(std::shared_ptr<Thread> thread, unsigned int time) {
+    if (thread->absolute_deadline == -1) {
+        return;
+    }
+
+    int lateness = (int) time - thread->absolute_deadline;
+    system_stats.deadline_jobs[thread->priority]++;
+    system_stats.lateness.push_back(lateness);
+
+    if (lateness > 0) {
+        system_stats.deadline_misses[thread->priority]++;
+        system_stats.total_tardiness[thread->priority] += lateness;
+    }
+}
+
 SystemStats Simulation::calculate_statistics(){
     //Loop through the thread types and get all of the stats for remaining values 
     for(int i=0; i < 4; i++){
@@ -251,10 +1067,77 @@ SystemStats Simulation::calculate_statistics(){
         }
     }
     //update all of the system stats to get the proper calulation when printing.
+    // With several cores, the time available is the elapsed time on every core.
+    size_t capacity = system_stats.total_time * cores.size();
     system_stats.total_cpu_time = system_stats.dispatch_time + system_stats.service_time;
-    system_stats.total_idle_time = system_stats.total_time - system_stats.total_cpu_time;
-    system_stats.cpu_efficiency = 100.0 * system_stats.service_time / system_stats.total_time;
-    system_stats.cpu_utilization = 100.0 * system_stats.total_cpu_time / system_stats.total_time;
+    system_stats.total_idle_time = capacity - system_stats.total_cpu_time;
+    system_stats.cpu_efficiency = 100.0 * system_stats.service_time / capacity;
+    system_stats.cpu_utilization = 100.0 * system_stats.total_cpu_time / capacity;
+
+    system_stats.core_utilization.clear();
+    for (size_t i = 0; i < cores.size(); i++) {
+        size_t busy_time = system_stats.core_service_times[i] + system_stats.core_dispatch_times[i];
+        system_stats.core_utilization.push_back(100.0 * busy_time / system_stats.total_time);
+    }
+
+    if (!core_classes.empty()) {
+        size_t classes = core_classes.size();
+        system_stats.class_service_times.assign(classes, 0);
+        system_stats.class_dispatch_times.assign(classes, 0);
+        system_stats.class_utilization.assign(classes, 0.0);
+
+        for (const Core& core : cores) {
+            system_stats.class_service_times[core.core_class] += system_stats.core_service_times[core.id];
+            system_stats.class_dispatch_times[core.core_class] += system_stats.core_dispatch_times[core.id];
+        }
+        for (size_t i = 0; i < classes; i++) {
+            size_t busy_time = system_stats.class_service_times[i] + system_stats.class_dispatch_times[i];
+            system_stats.class_utilization[i] = 100.0 * busy_time / (system_stats.total_time * core_classes[i].count);
+        }
+    }
+
+    // Each CPU's cache is counted once, even if SMT siblings share it.
+    for (const Core& core : cores) {
+        if (core.cache != nullptr && (core.sibling == -1 || core.sibling > core.id)) {
+            system_stats.cache_warm_hits += core.cache->warm_hits;
+            system_stats.cache_cold_misses += core.cache->cold_misses;
+            system_stats.cache_evictions += core.cache->evictions;
+        }
+    }
+
+    // The mean imbalance overall and in each tenth of the elapsed time.
+    if (!system_stats.imbalance_samples.empty()) {
+        const int windows = 10;
+        std::vector<double> sums(windows, 0.0);
+        std::vector<int> counts(windows, 0);
+        double total = 0.0;
+
+        for (const auto& [time, imbalance] : system_stats.imbalance_samples) {
+            size_t window = std::min<size_t>(windows - 1, (size_t) time * windows / std::max<size_t>(1, system_stats.total_time));
+            sums[window] += imbalance;
+            counts[window]++;
+            total += imbalance;
+            system_stats.max_imbalance = std::max(system_stats.max_imbalance, imbalance);
+        }
+        system_stats.avg_imbalance = total / system_stats.imbalance_samples.size();
+
+        system_stats.imbalance_over_time.clear();
+        for (int i = 0; i < windows; i++) {
+            system_stats.imbalance_over_time.push_back(counts[i] > 0 ? sums[i] / counts[i] : -1.0);
+        }
+    }
+
+    // Nearest-rank percentiles of the burst lateness.
+    if (!system_stats.lateness.empty()) {
+        std::vector<int> sorted = system_stats.lateness;
+        std::sort(sorted.begin(), sorted.end());
+
+        const double ranks[4] = {0.50, 0.90, 0.99, 1.00};
+        for (int i = 0; i < 4; i++) {
+            size_t rank = (size_t) std::ceil(ranks[i] * sorted.size());
+            system_stats.lateness_percentiles[i] = sorted[std::max((size_t) 1, rank) - 1];
+        }
+    }
     return this->system_stats;
 }
 
@@ -264,60 +1147,85 @@ void Simulation::add_event(std::shared_ptr<Event> event) {
     }
 }
 
-void Simulation::read_file(const std::string filename) {
+void Simulation::read_topology(const std::string filename) {
     std::ifstream input_file(filename.c_str());
 
     if (!input_file) {
-        std::cerr << "Unable to open simulation file: " << filename << std::endl;
+        std::cerr << "Unable to open topology file: " << filename << std::endl;
         throw(std::logic_error("Bad file."));
     }
 
-    int num_processes;
+    std::string text;
+    while (std::getline(input_file, text)) {
+        std::istringstream line(text);
+        std::string setting;
+        int value;
 
-    input_file >> num_processes >> this->thread_switch_overhead >> this->process_switch_overhead;
+        if (!(line >> setting) || setting[0] == '#') {
+            continue;
+        }
 
-    for (int proc = 0; proc < num_processes; ++proc) {
-        auto process = read_process(input_file);
+        bool valid = (bool) (line >> value);
+        if (setting == "nodes") {
+            this->topology.nodes = value;
+            valid = valid && value > 0;
+        } else if (setting == "cores_per_node") {
+            this->topology.cores_per_node = value;
+            valid = valid && value > 0;
+        } else if (setting == "migration_penalty") {
+            this->topology.migration_penalty = value;
+            valid = valid && value >= 0;
+        } else if (setting == "remote_penalty") {
+            this->topology.remote_penalty = value;
+            valid = valid && value >= 0;
+        } else {
+            valid = false;
+        }
 
-        this->processes[process->process_id] = process;
+        if (!valid) {
+            std::cerr << "Invalid setting in topology file: " << text << std::endl;
+            throw(std::logic_error("Bad file."));
+        }
     }
 }
 
-std::shared_ptr<Process> Simulation::read_process(std::istream& input) {
-    int process_id, priority;
-    int num_threads;
-
-    input >> process_id >> priority >> num_threads;
-
-    auto process = std::make_shared<Process>(process_id, (ProcessPriority) priority);
-
-    // iterate over the threads
-    for (int thread_id = 0; thread_id < num_threads; ++thread_id) {
-        process->threads.emplace_back(read_thread(input, thread_id, process_id, (ProcessPriority) priority));
+void Simulation::load_workload() {
+    if (this->workload == nullptr) {
+        auto workload = std::make_shared<Workload>();
+        workload->read(this->flags.filename);
+        this->workload = workload;
     }
 
-    return process;
-}
-
-std::shared_ptr<Thread> Simulation::read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority) {
-    // Stuff
-    int arrival_time;
-    int num_cpu_bursts;
+    // A sweep may replace the switch overheads of the simulation file.
+    this->thread_switch_overhead = (this->flags.thread_switch_overhead >= 0) ? this->flags.thread_switch_overhead : this->workload->thread_switch_overhead;
+    this->process_switch_overhead = (this->flags.process_switch_overhead >= 0) ? this->flags.process_switch_overhead : this->workload->process_switch_overhead;
 
-    input >> arrival_time >> num_cpu_bursts;
-
-    auto thread = std::make_shared<Thread>(arrival_time, thread_id, process_id, priority);
-
-    for (int n = 0, burst_length; n < num_cpu_bursts * 2 - 1; ++n) {
-        input >> burst_length;
-
-        BurstType burst_type = (n % 2 == 0) ? BurstType::CPU : BurstType::IO;
+    for (const auto& scheduler : this->schedulers) {
+        scheduler->thread_switch_overhead = this->thread_switch_overhead;
+        scheduler->process_switch_overhead = this->process_switch_overhead;
+        for (const Group& group : this->workload->groups) {
+            scheduler->add_group(group);
+        }
+    }
 
-        thread->bursts.push(std::make_shared<Burst>(burst_type, burst_length));
+    // SMT siblings share the caches of their CPU.
+    if (this->workload->cache_capacity > 0) {
+        for (Core& core : this->cores) {
+            if (core.sibling != -1 && core.sibling < core.id) {
+                core.cache = this->cores[core.sibling].cache;
+            } else {
+                core.cache = std::make_shared<WarmthCache>(this->workload->cache_capacity, this->workload->cache_cold_cost, this->workload->cache_half_life);
+            }
+        }
     }
 
-    this->events.push(std::make_shared<Event>(EventType::THREAD_ARRIVED, thread->arrival_time, this->event_num, thread, nullptr));
-    this->event_num++;
+    for (const auto& process : this->workload->copy_processes()) {
+        for (const auto& thread : process->threads) {
+            thread->predictor = BurstPredictor(10.0, this->flags.alpha, this->flags.history);
 
-    return thread;
+            this->events.push(std::make_shared<Event>(EventType::THREAD_ARRIVED, thread->arrival_time, this->event_num, thread));
+            this->event_num++;
+        }
+        this->processes[process->process_id] = process;
+    }
 }
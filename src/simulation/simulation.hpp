@@ -7,18 +7,24 @@
 #include <memory>
 #include <queue>
 #include <string>
+#include <vector>
 
 #include "algorithms/scheduling_algorithm.hpp"
 #include "types/process/process.hpp"
 #include "types/thread/thread.hpp"
 #include "types/system_stats/system_stats.hpp"
 #include "types/event/event.hpp"
+#include "types/core/core.hpp"
+#include "types/topology/topology.hpp"
+#include "types/workload/workload.hpp"
 
 #include "utilities/flags/flags.hpp"
 #include "utilities/logger/logger.hpp"
 
 using EventQueue = std::priority_queue<std::shared_ptr<Event>, std::vector<std::shared_ptr<Event>>, EventComparator>;
 
+class ParallelEngine;
+
 /*
     Simulation:
         A class that encapsulates the entire simulation logic. Contains all the member variables
@@ -32,6 +38,13 @@ public:
     //  Member variables
     //==================================================
 
+    /*
+        workload:
+            The simulation file, read by simulate() unless the simulation was given one to
+            share with other simulations.
+    */
+    std::shared_ptr<const Workload> workload = nullptr;
+
     /*
         processes:
             A map of process IDs to their corresponding process object.
@@ -39,27 +52,40 @@ public:
     std::map<int, std::shared_ptr<Process>> processes;
 
     /*
-        scheduler:
-            A pointer to a scheduler object. Since the Scheduler class is a base class,
-            a pointer to it is also valid to point to any of the derived classes. So you
-            just need one pointer here, but it could point to any algorithm you derive
-            from the Scheduler class.
+        schedulers:
+            Pointers to scheduler objects. Since the Scheduler class is a base class,
+            a pointer to it is also valid to point to any of the derived classes.
+
+            There is one scheduler, shared by every core, unless a load balancing policy
+            was chosen with --balance. Then each core has its own, in the same order as cores.
+    */
+    std::vector<std::shared_ptr<Scheduler>> schedulers;
+
+    /*
+        cores:
+            The simulated CPUs, indexed by their id. There is one unless --cpus is given.
+    */
+    std::vector<Core> cores;
+
+    /*
+        topology:
+            How the cores are split into NUMA nodes. One node with every core unless --numa
+            is given.
     */
-    std::shared_ptr<Scheduler> scheduler;
+    Topology topology;
 
     /*
-        active_thread:
-            The thread that is currently on the CPU. If no thread is on the
-            CPU, it should point to nullptr.
+        fastest_speed:
+            The speed of the fastest core class, or 1.0 without core classes.
     */
-    std::shared_ptr<Thread> active_thread = nullptr;
+    double fastest_speed = 1.0;
 
     /*
-        prev_thread:
-            The thread that was previously on the CPU, or nullptr if there was
-            not thread previously on the CPU.
+        core_classes:
+            The core classes from --core_classes, with their counts in cores (two per CPU
+            with SMT).
     */
-    std::shared_ptr<Thread> prev_thread = nullptr;
+    std::vector<CoreClass> core_classes;
 
     /*
         thread_switch_overhead:
@@ -87,6 +113,23 @@ public:
     */
     EventQueue events;
 
+    /*
+        arrivals, arrived_threads:
+            Reused buffers for the events at the same time that are handled as one batch
+            (THREAD_ARRIVED events, or DISPATCHER_INVOKED events of cores that share the
+            ready queue), and for the threads that arrived.
+    */
+    std::vector<std::shared_ptr<Event>> arrivals;
+    std::vector<std::shared_ptr<Thread>> arrived_threads;
+
+    /*
+        dispatches, decisions:
+            Reused buffers for the DISPATCHER_INVOKED events of a batch whose cores do
+            dispatch, and for the decisions picked for them together.
+    */
+    std::vector<std::shared_ptr<Event>> dispatches;
+    std::vector<SchedulingDecision> decisions;
+
     /*
         system_stats:
             A SystemStats object for storing various simulation statistics.
@@ -107,6 +150,13 @@ public:
     */
     FlagOptions flags;
 
+    /*
+        engine:
+            With --pdes, the parallel engine that ran the simulation, for its metrics.
+            nullptr otherwise.
+    */
+    std::shared_ptr<ParallelEngine> engine = nullptr;
+
     //==================================================
     //  Member functions
     //==================================================
@@ -118,19 +168,39 @@ public:
     Simulation() {}
 
     /*
-        Simulation(flags):
+        Simulation(flags, workload, out):
             A constructor for the simulation that takes in the flags
-            that the user passed in when they invoked the program.
+            that the user passed in when they invoked the program, and optionally
+            the workload to run instead of reading the simulation file and the stream
+            to print to instead of standard output.
     */
-    Simulation(FlagOptions flags);
+    Simulation(FlagOptions flags, std::shared_ptr<const Workload> workload = nullptr, std::ostream& out = std::cout);
 
     /*
         run():
             The main loop of the simulation. This function reads in the
             specified simulation file, populates all the required data structure,
             and then begins the next-event simulation for the CPU scheduler.
+            Returns the statistics that it printed.
     */
-    void run();
+    SystemStats run();
+
+    /*
+        simulate():
+            Reads in the simulation file and runs the next-event simulation to the end,
+            without printing any metrics. Called by run(). With --pdes, the parallel engine
+            runs it instead.
+    */
+    void simulate();
+
+    /*
+        handle_event(batch):
+            Handles the first event of the batch, which is the next one in the simulation,
+            with the handler for its type. A THREAD_ARRIVED event comes with every other
+            arrival at the same time. Prints the state changes of their threads and moves
+            the elapsed time up to the event's.
+    */
+    void handle_event(const std::vector<std::shared_ptr<Event>>& batch);
 
     /*
         handle_*:
@@ -138,7 +208,8 @@ public:
             event type.
 
             For example, within handle_thread_arrived, you would want to
-            perform the appropriate actions for the THREAD_ARRIVED event. You should
+            perform the appropriate actions for the THREAD_ARRIVED event. All the
+            threads that arrive at the same time are passed to it as one batch. You should
             look at the Project Description for an example of what this function should
             do.
 
@@ -146,7 +217,7 @@ public:
             Deliverable 1 of this project, and then for Deliverable 2 you will have to implement
             them.
     */
-    void handle_thread_arrived(const std::shared_ptr<Event> event);
+    void handle_thread_arrived(const std::vector<std::shared_ptr<Event>>& events);
 
     void handle_dispatch_completed(const std::shared_ptr<Event> event);
 
@@ -158,28 +229,51 @@ public:
 
     void handle_thread_preempted(const std::shared_ptr<Event> event);
 
-    void handle_dispatcher_invoked(const std::shared_ptr<Event> event);
+    void handle_dispatcher_invoked(const std::vector<std::shared_ptr<Event>>& events);
+
+    void handle_load_balance(const std::shared_ptr<Event> event);
+
+    /*
+        dispatch(core, event, decision):
+            Starts dispatching the thread the scheduler picked for the core when the
+            dispatcher was invoked, or leaves the core idle if it picked none.
+    */
+    void dispatch(Core& core, const std::shared_ptr<Event>& event, SchedulingDecision decision);
 
     /*
-        read_file(filename):
-            This function reads in the simulation file, as specified by filename. If filename is
-            blank, then it reads in from stdin.
+        create_scheduler(flags):
+            Creates the scheduling algorithm chosen by the flags.
     */
-    void read_file(const std::string filename);
+    static std::shared_ptr<Scheduler> create_scheduler(const FlagOptions& flags);
 
     /*
-        read_process(input):
-            Reads in a process from the simulation file. Called by read_file
-            for each process that is provided in the simulation file.
+        load_workload():
+            Reads the simulation file, unless the simulation was given a workload, and sets
+            up a copy of its processes, groups and cache to run. Each thread's arrival is
+            added to the event queue, in the order of the file.
     */
-    std::shared_ptr<Process> read_process(std::istream& input);
+    void load_workload();
 
     /*
-        read_thread(input, thread_id, process_id, priority):
-            Reads in a thread from the simulation file. Called by read_process
-            for each thread in a process, as provided by the simulation file.
+        read_topology(filename):
+            Reads the NUMA topology file given with --numa (see the Topology class).
     */
-    std::shared_ptr<Thread> read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority);
+    void read_topology(const std::string filename);
+
+    /*
+        complete_cpu_burst(thread, time, cpu):
+            Called when the thread's current CPU burst completes at the given time on the given
+            core. Records its deadline, tells the core's scheduler how long the burst was, and
+            pops it.
+    */
+    void complete_cpu_burst(std::shared_ptr<Thread> thread, unsigned int time, int cpu);
+
+    /*
+        record_deadline(thread, time):
+            Called when a thread's CPU burst completes at the given time. If the burst had
+            a deadline, records its lateness in the system stats.
+    */
+    void record_deadline(std::shared_ptr<Thread> thread, unsigned int time);
 
     /*
         calculate_statistics():
@@ -188,6 +282,114 @@ public:
     */
     SystemStats calculate_statistics();
 
+    /*
+        preempt_if_needed(time):
+            Asks the scheduler whether a ready thread should take a core from its running
+            thread. If so, the pending end of that run is cancelled, the unused part of the
+            burst is handed back to the thread, and a THREAD_PREEMPTED event is created for the
+            given time. Nothing is preempted while a core is idle, and at most one core is
+            preempted per call.
+    */
+    void preempt_if_needed(unsigned int time);
+
+    /*
+        invoke_dispatcher(time, cpu):
+            Creates a DISPATCHER_INVOKED event for the given core at the given time, and
+            returns it.
+    */
+    std::shared_ptr<Event> invoke_dispatcher(unsigned int time, int cpu);
+
+    /*
+        next_idle_core(after):
+            Returns the first idle core (see core_idle) after the given one, wrapping around
+            to the first core, or -1 if no core is idle. Pass -1 to search from the first core.
+            With SMT, cores with an idle sibling are preferred.
+    */
+    int next_idle_core(int after) const;
+
+    /*
+        core_idle(core):
+            Whether the core has no active thread and, with several cores, no dispatch
+            pending either.
+    */
+    bool core_idle(const Core& core) const;
+
+    /*
+        push_threads(loads, first, last, time):
+            Push migration between cores first to last - 1: moves ready threads from the most
+            to the least loaded of them until their loads differ by at most one. loads holds
+            every core's load, and is kept up to date.
+    */
+    void push_threads(std::vector<int>& loads, int first, int last, unsigned int time);
+
+    /*
+        queue_on_core(thread, time):
+            With per-core ready queues, adds a thread that has become ready to the queue of the
+            core it last ran on, or of the least loaded core if it has not run yet. With a
+            NUMA-aware placement, the core must be on the process's home node. Invokes the
+            dispatcher on that core if it is idle, or otherwise, with stealing, on an idle core.
+    */
+    void queue_on_core(std::shared_ptr<Thread> thread, unsigned int time);
+
+    /*
+        steal_thread(core, time):
+            Moves a ready thread from the longest other ready queue to the given core's, preferring
+            (or, with the "strict" placement, only taking) one on the same node. Returns false if
+            stealing is off or there is no ready thread to take.
+    */
+    bool steal_thread(Core& core, unsigned int time);
+
+    /*
+        core_load(core):
+            The number of ready threads in the core's queue, plus one if it is running a thread.
+    */
+    int core_load(const Core& core) const;
+
+    /*
+        least_loaded_core(node, fast, process_id):
+            Returns the core with the lowest load among those that match (see core_matches), or
+            -1 if none do. With SMT, ties go to the core whose sibling has the lower load, and
+            then to the first one.
+    */
+    int least_loaded_core(int node = -1, int fast = -1, int process_id = -1) const;
+
+    /*
+        core_matches(core, node, fast, process_id):
+            Whether the core is on the given node; if fast is 1, of the fastest core class or,
+            if fast is 0, of a slower one; and, with SMT, has an idle sibling or one running a
+            thread of the given process. -1 matches any core.
+    */
+    bool core_matches(const Core& core, int node, int fast, int process_id = -1) const;
+
+    /*
+        sibling_running(core):
+            Whether the core's SMT sibling is running a thread.
+    */
+    bool sibling_running(const Core& core) const;
+
+    /*
+        retime_run(core, time):
+            Called when the core's sibling starts or stops running at the given time. Moves
+            the end of the core's current run to match its new rate, and updates how much of
+            the burst the run will do.
+    */
+    void retime_run(Core& core, unsigned int time);
+
+    /*
+        run_ended(core, time):
+            Called when the core's run ends, or is preempted, at the given time. Lets its
+            sibling run at full speed, and keeps the process's footprint warm in the core's
+            cache until then.
+    */
+    void run_ended(Core& core, unsigned int time);
+
+    /*
+        preferred_class(thread, time):
+            With --class_placement, whether the thread that became ready at the given time
+            should go to the fastest cores (1) or the others (0). -1 if any core will do.
+    */
+    int preferred_class(const Thread& thread, unsigned int time) const;
+
     /*
         add_event(event):
             Checks to see if the event is not a nullptr,
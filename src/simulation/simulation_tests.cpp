@@ -0,0 +1,36 @@
+#include "simulation/simulation.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "algorithms/gang/gang_algorithm.hpp"
+
+TEST(Simulation, MigrationsDoNotUseGangQuantum) {
+    // A thread that moves to another CPU's ready queue has not run, so only the dispatches
+    // use up quantum, and together they use exactly the CPU time the threads got.
+    for (std::string balance : {"steal", "push", "both"}) {
+        FlagOptions flags;
+        flags.filename = "tests/input/input-4";
+        flags.scheduler = "GANG";
+        flags.cpus = 4;
+        flags.balance = balance;
+
+        std::ostringstream output;
+        Simulation simulation(flags, nullptr, output);
+        simulation.simulate();
+
+        const SystemStats& stats = simulation.system_stats;
+        ASSERT_GT(stats.steals + stats.push_migrations, 0u) << balance;
+
+        long used = 0;
+        for (const auto& scheduler : simulation.schedulers) {
+            for (const auto& entry : std::dynamic_pointer_cast<GANGScheduler>(scheduler)->quantum_used) {
+                used += entry.second;
+            }
+        }
+        EXPECT_EQ(used, stats.service_time) << balance;
+    }
+}
@@ -0,0 +1,95 @@
+#include "simulation/sweep.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+#include "simulation/simulation.hpp"
+#include "utilities/task_runtime/task_runtime.hpp"
+
+Sweep::Sweep(const FlagOptions& flags) {
+    // An empty list leaves the parameter as the flags have it.
+    std::vector<std::string> algorithms = flags.sweep_algorithms;
+    std::vector<int> time_slices = flags.sweep_time_slices;
+    std::vector<int> thread_overheads = flags.sweep_thread_overheads;
+    std::vector<int> process_overheads = flags.sweep_process_overheads;
+    if (algorithms.empty()) {
+        algorithms.push_back(flags.scheduler);
+    }
+    if (time_slices.empty()) {
+        time_slices.push_back(flags.time_slice);
+    }
+    if (thread_overheads.empty()) {
+        thread_overheads.push_back(flags.thread_switch_overhead);
+    }
+    if (process_overheads.empty()) {
+        process_overheads.push_back(flags.process_switch_overhead);
+    }
+
+    for (const std::string& algorithm : algorithms) {
+        for (int time_slice : time_slices) {
+            if (!uses_time_slice(algorithm) && time_slice != time_slices.front()) {
+                continue;
+            }
+            for (int thread_overhead : thread_overheads) {
+                for (int process_overhead : process_overheads) {
+                    FlagOptions run = flags;
+                    run.metrics = false;
+                    run.scheduler = algorithm;
+                    run.time_slice = uses_time_slice(algorithm) ? time_slice : -1;
+                    run.thread_switch_overhead = thread_overhead;
+                    run.process_switch_overhead = process_overhead;
+                    this->runs.push_back(run);
+                }
+            }
+        }
+    }
+
+    this->jobs = (flags.jobs > 0) ? flags.jobs : std::max(1u, std::thread::hardware_concurrency());
+    this->jobs = std::min(this->jobs, (int) this->runs.size());
+}
+
+void Sweep::run() {
+    auto workload = std::make_shared<Workload>();
+    workload->read(this->runs.front().filename);
+    this->workload = workload;
+    this->results.assign(this->runs.size(), SystemStats());
+
+    // Settings that are wrong for every run, like a bad topology file, are reported once
+    // before the threads start.
+    Simulation check(this->runs.front(), this->workload);
+
+    // Each result goes to its run's place, whichever worker simulates it.
+    TaskRuntime runtime(this->jobs);
+    runtime.parallel_for(this->runs.size(), [this](size_t index) {
+        this->simulate(index);
+    });
+}
+
+void Sweep::simulate(size_t index) {
+    Simulation simulation(this->runs[index], this->workload);
+    simulation.simulate();
+    this->results[index] = simulation.calculate_statistics();
+}
+
+void Sweep::print_results(std::ostream& out) const {
+    out << "algorithm,time_slice,thread_overhead,process_overhead,elapsed_time,service_time,io_time,"
+        << "dispatch_time,idle_time,cpu_utilization,cpu_efficiency,avg_response_time,avg_turnaround_time\n";
+
+    for (size_t i = 0; i < this->runs.size(); i++) {
+        const FlagOptions& run = this->runs[i];
+        const SystemStats& stats = this->results[i];
+
+        auto [threads, response, turnaround] = stats.overall_averages();
+
+        out << fmt::format("{},{},{},{},{},{},{},{},{},{:.2f},{:.2f},{:.2f},{:.2f}\n",
+            run.scheduler,
+            (run.time_slice > 0) ? std::to_string(run.time_slice) : "-",
+            (run.thread_switch_overhead >= 0) ? run.thread_switch_overhead : this->workload->thread_switch_overhead,
+            (run.process_switch_overhead >= 0) ? run.process_switch_overhead : this->workload->process_switch_overhead,
+            stats.total_time, stats.service_time, stats.io_time, stats.dispatch_time, stats.total_idle_time,
+            stats.cpu_utilization, stats.cpu_efficiency, response, turnaround);
+    }
+}
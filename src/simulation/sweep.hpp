@@ -0,0 +1,91 @@
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "types/system_stats/system_stats.hpp"
+#include "types/workload/workload.hpp"
+
+#include "utilities/flags/flags.hpp"
+
+/*
+    Sweep:
+        Runs the same workload once for every combination of the parameters given with
+        --sweep. The simulation file is read once, and the runs share it. They are
+        independent, so they run in parallel, on a TaskRuntime with --jobs workers, and each
+        one's results are kept in its place, so the output does not depend on the number of
+        workers.
+*/
+
+class Sweep {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        runs:
+            The flags of every run, in order: the algorithms vary slowest, then the time
+            slices, the thread switch overheads and the process switch overheads.
+    */
+    std::vector<FlagOptions> runs;
+
+    /*
+        results:
+            The statistics of every run, in the same order as runs. Empty until run().
+    */
+    std::vector<SystemStats> results;
+
+    /*
+        jobs:
+            How many runs are simulated at the same time.
+    */
+    int jobs = 1;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        Sweep(flags):
+            Creates the runs of the sweep described by the flags. Algorithms that do not
+            take a time slice are only run once, without one, for all the time slices.
+    */
+    Sweep(const FlagOptions& flags);
+
+    /*
+        run():
+            Reads the simulation file and simulates every run. Throws if the simulation file
+            or any run is invalid.
+    */
+    void run();
+
+    /*
+        print_results(out):
+            Prints the results as CSV, with a header line and one line per run:
+
+                algorithm,time_slice,thread_overhead,process_overhead,elapsed_time,...
+
+            A time slice of - means the algorithm's default.
+    */
+    void print_results(std::ostream& out) const;
+
+private:
+
+    /*
+        workload:
+            The simulation file, shared by every run.
+    */
+    std::shared_ptr<const Workload> workload;
+
+    /*
+        simulate(index):
+            Simulates the run with the given index and stores its results.
+    */
+    void simulate(size_t index);
+};
+
+#endif
@@ -0,0 +1,11 @@
+#include <gtest/gtest.h>
+
+/*
+    The entry point of the unit tests, which are in the *_tests.cpp files next to the code
+    they test.
+*/
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -7,6 +7,7 @@ Burst::Burst(BurstType type, int length)
 {
     this->burst_type = type;
     this->length = length;
+    this->initial_length = length;
 }
 
 void Burst::update_time(int delta_t)
@@ -28,6 +28,21 @@ public:
     */
     int length;
 
+    /*
+        initial_length:
+            The length of the burst as given in the simulation file. Unlike length, it
+            does not change as the burst runs.
+    */
+    int initial_length;
+
+    /*
+        deadline:
+            For CPU bursts, how long after the burst becomes ready it should be
+            finished. Taken from the simulation file; -1 if the burst has no deadline
+            of its own.
+    */
+    int deadline = -1;
+
     //==================================================
     //  Member functions
     //==================================================
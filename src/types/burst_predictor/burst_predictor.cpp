@@ -0,0 +1,51 @@
+#include "burst_predictor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+BurstPredictor::BurstPredictor(double initial, double alpha, size_t history)
+{
+    this->prediction = initial;
+    this->alpha = alpha;
+    this->history = history;
+}
+
+void BurstPredictor::observe(int length)
+{
+    double error = length - prediction;
+    samples++;
+    total_error += error;
+    total_abs_error += std::fabs(error);
+    total_squared_error += error * error;
+
+    if (history == 0) {
+        prediction = alpha * length + (1.0 - alpha) * prediction;
+        return;
+    }
+
+    recent.push_back(length);
+    if (recent.size() > history) {
+        recent.pop_front();
+    }
+
+    std::vector<int> sorted(recent.begin(), recent.end());
+    std::sort(sorted.begin(), sorted.end());
+    size_t middle = sorted.size() / 2;
+    prediction = (sorted.size() % 2 == 1) ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0;
+}
+
+double BurstPredictor::mean_abs_error() const
+{
+    return samples == 0 ? 0.0 : total_abs_error / samples;
+}
+
+double BurstPredictor::root_mean_squared_error() const
+{
+    return samples == 0 ? 0.0 : std::sqrt(total_squared_error / samples);
+}
+
+double BurstPredictor::bias() const
+{
+    return samples == 0 ? 0.0 : total_error / samples;
+}
@@ -0,0 +1,96 @@
+#ifndef BURST_PREDICTOR_HPP
+#define BURST_PREDICTOR_HPP
+
+#include <cstddef>
+#include <deque>
+
+/*
+    BurstPredictor:
+        Predicts the length of a thread's next CPU burst from the lengths of its
+        previous bursts, the way a real scheduler has to.
+
+        By default it uses exponential averaging:
+            prediction = alpha * last_burst + (1 - alpha) * prediction
+        If history is greater than zero, it instead predicts the median of the last
+        history bursts.
+
+        It also keeps track of how far off its predictions were.
+*/
+
+class BurstPredictor {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        alpha:
+            The weight of the most recent burst in the exponential average, between 0 and 1.
+    */
+    double alpha = 0.5;
+
+    /*
+        history:
+            If greater than zero, how many recent bursts the median predictor looks at.
+            0 uses exponential averaging.
+    */
+    size_t history = 0;
+
+    /*
+        prediction:
+            The predicted length of the next CPU burst.
+    */
+    double prediction = 10.0;
+
+    /*
+        recent:
+            The most recent burst lengths, oldest first. Only kept for the median predictor.
+    */
+    std::deque<int> recent;
+
+    /*
+        samples, total_error, total_abs_error, total_squared_error:
+            The number of predictions checked against an actual burst, and the sums of
+            their errors (actual - predicted), absolute errors and squared errors.
+    */
+    size_t samples = 0;
+    double total_error = 0.0;
+    double total_abs_error = 0.0;
+    double total_squared_error = 0.0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        BurstPredictor(initial, alpha, history):
+            Creates a predictor whose first prediction is initial.
+    */
+    BurstPredictor(double initial = 10.0, double alpha = 0.5, size_t history = 0);
+
+    /*
+        predict():
+            Returns the predicted length of the next CPU burst.
+    */
+    double predict() const { return prediction; }
+
+    /*
+        observe(length):
+            Records the error of the current prediction against the actual burst length,
+            and updates the prediction.
+    */
+    void observe(int length);
+
+    /*
+        mean_abs_error(), root_mean_squared_error(), bias():
+            Error statistics over all observed bursts, or 0 if there were none.
+    */
+    double mean_abs_error() const;
+
+    double root_mean_squared_error() const;
+
+    double bias() const;
+};
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef CORE_HPP
+#define CORE_HPP
+
+#include <memory>
+
+#include "algorithms/scheduling_algorithm.hpp"
+#include "types/event/event.hpp"
+#include "types/thread/thread.hpp"
+#include "utilities/warmth_cache/warmth_cache.hpp"
+
+/*
+    Core:
+        The state of one simulated CPU. Each core pays its own thread and process switch
+        overhead. The cores share one scheduler (ready queue) unless a load balancing policy
+        is chosen, in which case each has its own.
+*/
+
+class Core {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        id:
+            The core's number, from 0.
+    */
+    int id = 0;
+
+    /*
+        core_class, speed:
+            The index of the core's class in --core_classes, or -1 without core classes, and
+            the speed it runs at (see the CoreClass class).
+    */
+    int core_class = -1;
+    double speed = 1.0;
+
+    /*
+        sibling:
+            With SMT, the id of the other hardware thread of the same physical CPU, or -1
+            without SMT.
+    */
+    int sibling = -1;
+
+    /*
+        scheduler:
+            The scheduler the core takes its threads from.
+    */
+    std::shared_ptr<Scheduler> scheduler = nullptr;
+
+    /*
+        cache:
+            The warmth of the core's caches for each process, or nullptr unless the simulation
+            file has a "cache" directive. SMT siblings share one.
+    */
+    std::shared_ptr<WarmthCache> cache = nullptr;
+
+    /*
+        active_thread:
+            The thread that is currently on the core. If no thread is on the
+            core, it should point to nullptr.
+    */
+    std::shared_ptr<Thread> active_thread = nullptr;
+
+    /*
+        prev_thread:
+            The thread that was previously on the core, or nullptr if there was
+            not thread previously on the core.
+    */
+    std::shared_ptr<Thread> prev_thread = nullptr;
+
+    /*
+        active_event:
+            The pending event that ends the active thread's current run on the core (a
+            CPU_BURST_COMPLETED, THREAD_COMPLETED or THREAD_PREEMPTED event), or nullptr if
+            no thread is running. A preemption cancels this event.
+    */
+    std::shared_ptr<Event> active_event = nullptr;
+
+    /*
+        wakeup_event:
+            A pending DISPATCHER_INVOKED event created because the core went idle while the
+            scheduler still had threads that could not run yet (see Scheduler::next_wakeup_time),
+            or nullptr. Any other dispatch on the core cancels it.
+    */
+    std::shared_ptr<Event> wakeup_event = nullptr;
+
+    /*
+        busy:
+            True from the moment a thread is dispatched to the core until its run ends.
+    */
+    bool busy = false;
+
+    /*
+        dispatch_pending:
+            True from the moment the dispatcher is invoked on the core until it runs, so that
+            a core about to take a thread is not picked for another one in the meantime. A
+            wake-up (see wakeup_event) does not count.
+    */
+    bool dispatch_pending = false;
+
+    /*
+        run_work:
+            How much of the active thread's CPU burst, at the reference speed, its current run
+            will do. A preemption hands back the part not done.
+    */
+    int run_work = 0;
+
+    /*
+        slowdown, rate_since, work_done:
+            How much slower than its speed the core runs (the SMT slowdown while its sibling
+            is running too, and 1.0 otherwise), since when, and the work the current run had
+            done by then.
+    */
+    double slowdown = 1.0;
+    unsigned int rate_since = 0;
+    double work_done = 0.0;
+
+    /*
+        slice_end:
+            When the current run's time slice ends, or -1 if it runs to the end of its burst.
+    */
+    int slice_end = -1;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    Core(int id = 0): id(id) {}
+};
+
+#endif
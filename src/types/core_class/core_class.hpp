@@ -0,0 +1,51 @@
+#ifndef CORE_CLASS_HPP
+#define CORE_CLASS_HPP
+
+#include <string>
+
+/*
+    CoreClass:
+        A kind of CPU on a machine that mixes fast and slow cores, like the performance and
+        efficiency cores of a big.LITTLE design. Classes are given with --core_classes as a
+        comma-separated list:
+
+            <name>:<count>:<speed>,<name>:<count>:<speed>,...
+
+        The CPUs are numbered class by class, in the order given.
+*/
+
+class CoreClass {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        name:
+            The class's name, used when printing metrics.
+    */
+    std::string name;
+
+    /*
+        count:
+            The number of CPUs of this class.
+    */
+    int count = 1;
+
+    /*
+        speed:
+            How fast the class's CPUs run, relative to the reference speed of 1.0 that burst
+            lengths in the simulation file are measured at. A CPU burst of length L takes
+            L / speed ticks, rounded up, on one of these CPUs.
+    */
+    double speed = 1.0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    CoreClass(std::string name, int count, double speed): name(name), count(count), speed(speed) {}
+};
+
+#endif
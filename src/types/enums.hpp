@@ -27,7 +27,8 @@ enum EventType {
     IO_BURST_COMPLETED,
     THREAD_COMPLETED,
     THREAD_PREEMPTED,
-    DISPATCHER_INVOKED
+    DISPATCHER_INVOKED,
+    LOAD_BALANCE
 };
 
 enum ProcessPriority {
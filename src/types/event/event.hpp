@@ -2,6 +2,7 @@
 #define EVENT_HPP
 
 #include <memory>
+#include <utility>
 #include <iostream>
 #include <vector>
 
@@ -53,9 +54,24 @@ public:
     /*
         scheduling_decision:
             The associated scheduling decision for this event. We may get set this when we create
-            a new event within Simulation::handle_dispatcher_invoked(event).
+            a new event within Simulation::dispatch(core, event, decision). It is stored in the
+            event itself; if the event has no decision, its thread is nullptr.
     */
-    std::shared_ptr<SchedulingDecision> scheduling_decision;
+    SchedulingDecision scheduling_decision;
+
+    /*
+        cancelled:
+            Set when the event has been invalidated, for example because the running thread
+            was preempted before its burst ended. Cancelled events are skipped by the simulation.
+    */
+    bool cancelled = false;
+
+    /*
+        cpu:
+            The core the event happens on, for dispatcher, dispatch and end-of-run events,
+            or -1 for events that are not tied to a core (arrivals and IO completions).
+    */
+    int cpu = -1;
 
     //==================================================
     //  Member functions
@@ -66,10 +82,10 @@ public:
             The class constructor. Takes in an EventType representing the type of event it should be,
             a time representing when this event is scheduled to occur, an integer indicating which event this is,
             a Thread if one is associated with this event (or nullptr if one is not), and a SchedulingDecision if
-            one is associated with this event (or nullptr if one is not).
+            one is associated with this event (which may be left out if one is not).
     */
-    Event(EventType type, unsigned int time, unsigned int event_num, std::shared_ptr<Thread> thread, std::shared_ptr<SchedulingDecision> sd):
-        type(type), time(time), event_num(event_num), thread(thread), scheduling_decision(sd) {}
+    Event(EventType type, unsigned int time, unsigned int event_num, std::shared_ptr<Thread> thread, SchedulingDecision sd = SchedulingDecision()):
+        type(type), time(time), event_num(event_num), thread(thread), scheduling_decision(std::move(sd)) {}
 
     /*
         ~Event():
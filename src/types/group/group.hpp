@@ -0,0 +1,64 @@
+#ifndef GROUP_HPP
+#define GROUP_HPP
+
+#include <string>
+#include <vector>
+
+/*
+    Group:
+        A group of processes that share CPU time, like a tenant on a shared host. Groups
+        are defined by "group" lines in the header of the simulation file:
+
+            group <name> <shares> <quota> <period> <process id> <process id> ...
+
+        Algorithms that do not know about groups ignore them.
+*/
+
+class Group {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        name:
+            The group's name, used when printing metrics.
+    */
+    std::string name;
+
+    /*
+        shares:
+            The group's weight. While several groups have ready threads, each gets CPU
+            time in proportion to its shares. 1024 is the usual weight.
+    */
+    int shares = 1024;
+
+    /*
+        quota, period:
+            The group may use at most quota ticks of CPU time in every period ticks,
+            after which it is throttled until the period ends. A quota of -1 means
+            no limit.
+    */
+    int quota = -1;
+    int period = 100;
+
+    /*
+        process_ids:
+            The processes in the group.
+    */
+    std::vector<int> process_ids;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        Group(name, shares, quota, period):
+            A constructor for a group without any processes yet.
+    */
+    Group(std::string name, int shares, int quota, int period):
+        name(name), shares(shares), quota(quota), period(period) {}
+};
+
+#endif
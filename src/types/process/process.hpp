@@ -40,6 +40,13 @@ public:
     */
     std::vector<std::shared_ptr<Thread>> threads;
 
+    /*
+        home_node:
+            The NUMA node where the process's memory is: the node its first thread was placed
+            on or, with a shared ready queue, first ran on. -1 until then.
+    */
+    int home_node = -1;
+
     //==================================================
     //  Member functions
     //==================================================
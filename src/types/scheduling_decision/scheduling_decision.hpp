@@ -1,14 +1,17 @@
 #ifndef SCHEDULING_DECISION_HPP
 #define SCHEDULING_DECISION_HPP
 
+#include <cstddef>
 #include <memory>
+#include <string>
 
 #include "types/thread/thread.hpp"
 
 /*
     SchedulingDecision:
         A class for a scheduling decision. This is what your
-        algorithm should return.
+        algorithm should return. It is small and passed around by value,
+        so that making a decision does not allocate memory.
 */
 
 class SchedulingDecision {
@@ -28,9 +31,49 @@ public:
         explanation:
             A string containing an explanation of the scheduling decision. See
             the Scheduler class for an example of what this should be.
+
+            Building this string on every dispatch is wasted work unless the simulation
+            is verbose, so algorithms should fill in the fields below and set formatter
+            instead. Use explain() to get the explanation either way.
     */
     std::string explanation;
 
+    /*
+        formatter:
+            A function that builds the explanation from this decision's fields, or nullptr
+            if explanation has already been filled in. Only called by explain().
+    */
+    std::string (*formatter)(const SchedulingDecision& decision) = nullptr;
+
+    /*
+        source:
+            The ready queue the thread was taken from, e.g., its priority level. What it
+            means is up to the algorithm; -1 if the algorithm has a single queue.
+    */
+    int source = -1;
+
+    /*
+        label:
+            A name for the source, e.g., a group name, or nullptr. It must stay valid for
+            the whole simulation.
+    */
+    const char* label = nullptr;
+
+    /*
+        queue_sizes:
+            The number of threads in the ready queue(s) just before the decision. Algorithms
+            with a single queue only use the first entry.
+    */
+    size_t queue_sizes[4] = {0, 0, 0, 0};
+
+    /*
+        details, estimate:
+            Algorithm-specific numbers for the explanation, e.g., how long the thread waited
+            or the predicted length of its burst.
+    */
+    long details[2] = {0, 0};
+    double estimate = 0.0;
+
     /*
         time_slice:
             The time slice for preemptive algorithms. -1 if the thread
@@ -38,6 +81,25 @@ public:
     */
     int time_slice = -1;
 
+    /*
+        affinity_hit:
+            True if a thread further back in the ready queue was chosen over the head
+            because it belongs to the process that was already on the CPU.
+    */
+    bool affinity_hit = false;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        explain():
+            Returns the explanation of the decision, formatting it first if needed.
+    */
+    std::string explain() const {
+        return (formatter != nullptr) ? formatter(*this) : explanation;
+    }
+
 
 
 
@@ -1,6 +1,11 @@
 #ifndef SYSTEM_STATS_HPP
 #define SYSTEM_STATS_HPP
 
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 /*
     SystemStats:
         A simple class for encapsulating the statistics that
@@ -50,6 +55,15 @@ public:
     */
     size_t total_cpu_time = 0;
 
+    /*
+        core_service_times, core_dispatch_times, core_utilization:
+            The time each core spent executing threads and dispatching, and the percentage of
+            the elapsed time it did either. Indexed by core.
+    */
+    std::vector<size_t> core_service_times;
+    std::vector<size_t> core_dispatch_times;
+    std::vector<double> core_utilization;
+
     /*
         cpu_utilization:
             The percentage of time the CPU did work.
@@ -79,6 +93,181 @@ public:
             The average turnaround time for threads of different priorities.
     */
     double avg_thread_turnaround_times[4] = {0.0, 0.0, 0.0, 0.0};
+
+    /*
+        max_thread_wait_times[4]:
+            The longest time a thread of each priority spent in the ready queue
+            before being dispatched.
+    */
+    size_t max_thread_wait_times[4] = {0, 0, 0, 0};
+
+    /*
+        affinity_dispatches:
+            The number of dispatches where affinity chose a thread of the process already
+            on the CPU over the head of the ready queue.
+    */
+    size_t affinity_dispatches = 0;
+
+    /*
+        affinity_time_saved:
+            The dispatch time saved by those dispatches being thread switches instead of
+            process switches.
+    */
+    long affinity_time_saved = 0;
+
+    /*
+        prediction_samples[4], prediction_error[4], prediction_abs_error[4], prediction_squared_error[4]:
+            The number of CPU bursts whose length was predicted, and the sums of the prediction
+            errors (actual - predicted), absolute errors and squared errors, for each priority.
+    */
+    size_t prediction_samples[4] = {0, 0, 0, 0};
+    double prediction_error[4] = {0.0, 0.0, 0.0, 0.0};
+    double prediction_abs_error[4] = {0.0, 0.0, 0.0, 0.0};
+    double prediction_squared_error[4] = {0.0, 0.0, 0.0, 0.0};
+
+    /*
+        deadline_jobs[4]:
+            The number of completed CPU bursts with a deadline, for each priority.
+    */
+    size_t deadline_jobs[4] = {0, 0, 0, 0};
+
+    /*
+        deadline_misses[4]:
+            The number of CPU bursts that completed after their deadline, for each priority.
+    */
+    size_t deadline_misses[4] = {0, 0, 0, 0};
+
+    /*
+        total_tardiness[4]:
+            The total time by which CPU bursts missed their deadlines, for each priority.
+    */
+    size_t total_tardiness[4] = {0, 0, 0, 0};
+
+    /*
+        lateness:
+            The lateness (completion time minus deadline) of every CPU burst that had a
+            deadline. Negative values mean the burst finished early.
+    */
+    std::vector<int> lateness;
+
+    /*
+        lateness_percentiles[4]:
+            The 50th, 90th and 99th percentile and the maximum of the lateness values.
+    */
+    int lateness_percentiles[4] = {0, 0, 0, 0};
+
+    /*
+        migrations, migration_time:
+            The number of dispatches of a thread on a different CPU than it last ran on,
+            and the dispatch time they added.
+    */
+    size_t migrations = 0;
+    long migration_time = 0;
+
+    /*
+        steal_attempts, steals, push_migrations:
+            How many times a CPU with an empty ready queue tried to take a thread from
+            another, how many times it got one, and how many threads periodic balancing moved.
+    */
+    size_t steal_attempts = 0;
+    size_t steals = 0;
+    size_t push_migrations = 0;
+
+    /*
+        imbalance_samples:
+            The imbalance between the CPUs, sampled every balance interval as (time,
+            imbalance). The imbalance is the difference between the largest and smallest
+            load, where a CPU's load is its ready threads plus the one it is running.
+    */
+    std::vector<std::pair<unsigned int, int>> imbalance_samples;
+
+    /*
+        avg_imbalance, max_imbalance, imbalance_over_time:
+            The mean and largest sampled imbalance, and the mean in each tenth of the
+            elapsed time (-1 for a tenth without samples).
+    */
+    double avg_imbalance = 0.0;
+    int max_imbalance = 0;
+    std::vector<double> imbalance_over_time;
+
+    /*
+        cross_node_migrations, cross_node_migration_time:
+            The migrations between CPUs on different NUMA nodes, and the migration penalty
+            they added. These are also counted in migrations and migration_time.
+    */
+    size_t cross_node_migrations = 0;
+    long cross_node_migration_time = 0;
+
+    /*
+        remote_dispatches, remote_dispatch_time:
+            The dispatches of a thread on a node other than its process's home node, and the
+            remote penalty they added.
+    */
+    size_t remote_dispatches = 0;
+    long remote_dispatch_time = 0;
+
+    /*
+        node_remote_dispatches:
+            The remote dispatches on each node.
+    */
+    std::vector<size_t> node_remote_dispatches;
+
+    /*
+        class_service_times, class_dispatch_times, class_utilization:
+            The service and dispatch time on the CPUs of each core class, and the percentage
+            of their available time that they were busy.
+    */
+    std::vector<size_t> class_service_times;
+    std::vector<size_t> class_dispatch_times;
+    std::vector<double> class_utilization;
+
+    /*
+        cpu_work:
+            The total length of the CPU bursts that were completed, at the reference speed.
+    */
+    long cpu_work = 0;
+
+    /*
+        smt_contended_time:
+            With SMT, the total time that cores ran a thread while their sibling was running
+            one too.
+    */
+    size_t smt_contended_time = 0;
+
+    /*
+        cache_warm_hits, cache_cold_misses, cache_evictions, cache_refill_time:
+            With the cache model, how many dispatches found the process's footprint still in
+            the CPU's cache or not, how many footprints were evicted, and the refill cost that
+            was added to the dispatch time.
+    */
+    size_t cache_warm_hits = 0;
+    size_t cache_cold_misses = 0;
+    size_t cache_evictions = 0;
+    long cache_refill_time = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        overall_averages():
+            Returns the number of threads and their average response and turnaround times,
+            over every thread whatever its priority.
+    */
+    std::tuple<size_t, double, double> overall_averages() const {
+        size_t threads = 0;
+        double response = 0.0, turnaround = 0.0;
+        for (int p = 0; p < 4; p++) {
+            threads += thread_counts[p];
+            response += avg_thread_response_times[p] * thread_counts[p];
+            turnaround += avg_thread_turnaround_times[p] * thread_counts[p];
+        }
+        if (threads > 0) {
+            response /= threads;
+            turnaround /= threads;
+        }
+        return {threads, response, turnaround};
+    }
 };
 
 #endif
@@ -62,6 +62,17 @@ void Thread::set_finished(int time) {
 
 }
 
+void Thread::release_next_burst(int time) {
+    auto burst = get_next_burst(CPU);
+    int deadline = relative_deadline;
+
+    if (burst != nullptr && burst->deadline != -1) {
+        deadline = burst->deadline;
+    }
+
+    absolute_deadline = (deadline == -1) ? -1 : time + deadline;
+}
+
 int Thread::response_time() const {
     return start_time - arrival_time;
 }
@@ -7,6 +7,7 @@
 #include <queue>
 
 #include "types/burst/burst.hpp"
+#include "types/burst_predictor/burst_predictor.hpp"
 #include "types/enums.hpp"
 
 /*
@@ -15,9 +16,12 @@
         a thread needs, as well as the functionality that it needs. Anything
         that you may need to do on a thread should be done here. If there is
         something you feel is missing, please add it!
+
+        Threads are always created with std::make_shared, so that containers which hold
+        plain Thread pointers (like ThreadList) can hand out shared_ptrs again.
 */
 
-class Thread {
+class Thread : public std::enable_shared_from_this<Thread> {
 public:
 
     //==================================================
@@ -92,6 +96,62 @@ public:
     */
     ThreadState previous_state;
 
+    /*
+        relative_deadline:
+            How long after becoming ready each of the thread's CPU bursts should be finished,
+            unless a burst specifies its own deadline. Taken from the simulation file; -1 if the
+            thread has no deadline.
+    */
+    int relative_deadline = -1;
+
+    /*
+        absolute_deadline:
+            The time by which the current CPU burst should be finished, or -1 if it has
+            no deadline. Set by release_next_burst().
+    */
+    int absolute_deadline = -1;
+
+    /*
+        predictor:
+            Predicts the length of the thread's next CPU burst from its past bursts.
+    */
+    BurstPredictor predictor;
+
+    /*
+        virtual_runtime:
+            The CPU time the thread has been charged by a fair-share algorithm. The ready
+            thread with the lowest virtual runtime is the one furthest behind.
+    */
+    long virtual_runtime = 0;
+
+    /*
+        heap_index:
+            The thread's position in the ThreadHeap it is in, or -1 if it is not in one.
+            Maintained by ThreadHeap.
+    */
+    int heap_index = -1;
+
+    /*
+        ready_prev, ready_next:
+            The thread's neighbours in the ThreadList (ready queue) it is in, or nullptr.
+            Maintained by ThreadList.
+    */
+    Thread* ready_prev = nullptr;
+    Thread* ready_next = nullptr;
+
+    /*
+        last_cpu:
+            The core the thread last ran on, or -1 if it has not run yet.
+    */
+    int last_cpu = -1;
+
+    /*
+        affinity_bypasses:
+            How many times the thread has been passed over at the head of a ready queue
+            in favor of a thread of the process that was already on the CPU.
+    */
+    int affinity_bypasses = 0;
+
     /*
         bursts:
             A queue of bursts. Should contain the CPU and IO bursts in the correct order as
@@ -129,6 +189,14 @@ public:
     void set_state(ThreadState state, int time);
 
 
+    /*
+        release_next_burst(time):
+            Called when the thread becomes ready for a new CPU burst (on arrival or after an IO
+            burst). Sets absolute_deadline from the burst's deadline, or the thread's relative
+            deadline if the burst does not have one.
+    */
+    void release_next_burst(int time);
+
     /*
         response_time():
             Calculate the response time for this particular thread.
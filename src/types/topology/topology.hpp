@@ -0,0 +1,72 @@
+#ifndef TOPOLOGY_HPP
+#define TOPOLOGY_HPP
+
+/*
+    Topology:
+        How the simulated CPUs are split into NUMA nodes, and what it costs a thread to run
+        away from its memory. Topologies are read from a file given with --numa, one setting
+        per line (lines starting with # are comments):
+
+            nodes <count>
+            cores_per_node <count>
+            migration_penalty <ticks>
+            remote_penalty <ticks>
+
+        Without --numa, every CPU is on one node and nothing costs extra.
+*/
+
+class Topology {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        nodes, cores_per_node:
+            The number of nodes, and of CPUs on each. CPUs are numbered node by node, so
+            node 0 has CPUs 0 to cores_per_node - 1.
+    */
+    int nodes = 1;
+    int cores_per_node = 1;
+
+    /*
+        migration_penalty:
+            The extra dispatch overhead, on top of --migration_cost, for a thread that last ran
+            on a CPU of another node.
+    */
+    int migration_penalty = 0;
+
+    /*
+        remote_penalty:
+            The extra dispatch overhead for a thread that runs on a node other than its
+            process's home node, where the process's memory is.
+    */
+    int remote_penalty = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    Topology() {}
+
+    /*
+        Topology(nodes, cores_per_node):
+            A topology without any penalties.
+    */
+    Topology(int nodes, int cores_per_node): nodes(nodes), cores_per_node(cores_per_node) {}
+
+    /*
+        cpus():
+            The total number of CPUs.
+    */
+    int cpus() const { return nodes * cores_per_node; }
+
+    /*
+        node_of(cpu):
+            The node that the given CPU is on.
+    */
+    int node_of(int cpu) const { return cpu / cores_per_node; }
+};
+
+#endif
@@ -0,0 +1,154 @@
+#include "types/workload/workload.hpp"
+
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+/*
+    read_optional_value(input, value):
+        Reads the rest of the current line. If it holds an integer, it is stored in
+        value; otherwise value is left unchanged. This lets the simulation file carry
+        optional trailing values without breaking older files.
+*/
+static void read_optional_value(std::istream& input, int& value) {
+    std::string rest;
+    std::getline(input, rest);
+
+    std::istringstream line(rest);
+    int parsed;
+    if (line >> parsed) {
+        value = parsed;
+    }
+}
+
+void Workload::read(const std::string filename) {
+    std::ifstream input_file(filename.c_str());
+
+    if (!input_file) {
+        std::cerr << "Unable to open simulation file: " << filename << std::endl;
+        throw(std::logic_error("Bad file."));
+    }
+
+    int num_processes;
+
+    this->filename = filename;
+    input_file >> num_processes >> this->thread_switch_overhead >> this->process_switch_overhead;
+
+    read_directives(input_file);
+
+    for (int proc = 0; proc < num_processes; ++proc) {
+        auto process = read_process(input_file);
+
+        this->processes.push_back(process);
+    }
+}
+
+void Workload::read_directives(std::istream& input) {
+    // Directives start with a word, and processes start with a number.
+    while (input >> std::ws && std::isalpha(input.peek())) {
+        std::string directive, rest;
+        input >> directive;
+        std::getline(input, rest);
+        std::istringstream line(rest);
+
+        if (directive == "group") {
+            std::string name;
+            int shares, quota, period;
+
+            if (!(line >> name >> shares >> quota >> period) || shares <= 0 || period <= 0 || quota == 0 || quota < -1) {
+                std::cerr << "Invalid group in simulation file: " << directive << rest << std::endl;
+                throw(std::logic_error("Bad file."));
+            }
+
+            Group group(name, shares, quota, period);
+            for (int process_id; line >> process_id;) {
+                group.process_ids.push_back(process_id);
+            }
+            this->groups.push_back(group);
+        } else if (directive == "cache") {
+            int capacity, cold_cost, half_life;
+
+            if (!(line >> capacity >> cold_cost >> half_life) || capacity <= 0 || cold_cost < 0 || half_life <= 0) {
+                std::cerr << "Invalid cache in simulation file: " << directive << rest << std::endl;
+                throw(std::logic_error("Bad file."));
+            }
+
+            this->cache_capacity = capacity;
+            this->cache_cold_cost = cold_cost;
+            this->cache_half_life = half_life;
+        } else {
+            std::cerr << "Unknown directive in simulation file: " << directive << std::endl;
+            throw(std::logic_error("Bad file."));
+        }
+    }
+}
+
+std::shared_ptr<Process> Workload::read_process(std::istream& input) {
+    int process_id, priority;
+    int num_threads;
+
+    input >> process_id >> priority >> num_threads;
+
+    auto process = std::make_shared<Process>(process_id, (ProcessPriority) priority);
+
+    // iterate over the threads
+    for (int thread_id = 0; thread_id < num_threads; ++thread_id) {
+        process->threads.emplace_back(read_thread(input, thread_id, process_id, (ProcessPriority) priority));
+    }
+
+    return process;
+}
+
+std::shared_ptr<Thread> Workload::read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority) {
+    // Stuff
+    int arrival_time;
+    int num_cpu_bursts;
+
+    input >> arrival_time >> num_cpu_bursts;
+
+    auto thread = std::make_shared<Thread>(arrival_time, thread_id, process_id, priority);
+
+    // An extra value on the thread line is the thread's relative deadline.
+    read_optional_value(input, thread->relative_deadline);
+
+    for (int n = 0, burst_length; n < num_cpu_bursts; ++n) {
+        input >> burst_length;
+
+        auto cpu_burst = std::make_shared<Burst>(BurstType::CPU, burst_length);
+        thread->bursts.push(cpu_burst);
+
+        if (n < num_cpu_bursts - 1) {
+            input >> burst_length;
+            thread->bursts.push(std::make_shared<Burst>(BurstType::IO, burst_length));
+        }
+
+        // An extra value on a burst line is the deadline of that CPU burst.
+        read_optional_value(input, cpu_burst->deadline);
+    }
+
+    return thread;
+}
+
+std::vector<std::shared_ptr<Process>> Workload::copy_processes() const {
+    std::vector<std::shared_ptr<Process>> copies;
+    copies.reserve(this->processes.size());
+
+    for (const auto& process : this->processes) {
+        auto copy = std::make_shared<Process>(process->process_id, process->priority);
+
+        for (const auto& thread : process->threads) {
+            auto thread_copy = std::make_shared<Thread>(*thread);
+
+            // The bursts change as they run, so each copy needs its own.
+            std::queue<std::shared_ptr<Burst>> bursts = thread->bursts;
+            thread_copy->bursts = {};
+            for (; !bursts.empty(); bursts.pop()) {
+                thread_copy->bursts.push(std::make_shared<Burst>(*bursts.front()));
+            }
+            copy->threads.push_back(thread_copy);
+        }
+        copies.push_back(copy);
+    }
+    return copies;
+}
@@ -0,0 +1,119 @@
+#ifndef WORKLOAD_HPP
+#define WORKLOAD_HPP
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types/enums.hpp"
+#include "types/group/group.hpp"
+#include "types/process/process.hpp"
+#include "types/thread/thread.hpp"
+
+/*
+    Workload:
+        The contents of a simulation file. A workload is read once and never changed, so
+        any number of simulations, even running at the same time, can share it. Each gets
+        its own copy of the processes to run (see copy_processes).
+*/
+
+class Workload {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        filename:
+            The simulation file the workload was read from, or "" for none.
+    */
+    std::string filename = "";
+
+    /*
+        thread_switch_overhead, process_switch_overhead:
+            The switch overheads from the first line of the simulation file.
+    */
+    int thread_switch_overhead = 0;
+    int process_switch_overhead = 0;
+
+    /*
+        groups:
+            The groups defined by "group" directives, in order.
+    */
+    std::vector<Group> groups;
+
+    /*
+        cache_capacity, cache_cold_cost, cache_half_life:
+            The settings of the "cache" directive (see the WarmthCache class), or a capacity
+            of 0 if there is none.
+    */
+    int cache_capacity = 0;
+    int cache_cold_cost = 0;
+    int cache_half_life = 0;
+
+    /*
+        processes:
+            The processes, in the order of the simulation file. Their threads have not run.
+    */
+    std::vector<std::shared_ptr<Process>> processes;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    Workload() {}
+
+    /*
+        read(filename):
+            Reads in the simulation file, as specified by filename. Prints what is wrong and
+            throws a logic_error if it cannot be read.
+    */
+    void read(const std::string filename);
+
+    /*
+        copy_processes():
+            Returns new copies of the processes, in order, with their own threads and bursts
+            for a simulation to run.
+    */
+    std::vector<std::shared_ptr<Process>> copy_processes() const;
+
+private:
+
+    /*
+        read_directives(input):
+            Reads the optional directive lines that may follow the first line of the
+            simulation file, before the processes. Each starts with a word:
+
+                group <name> <shares> <quota> <period> <process id> ...
+                    Defines a group of processes (see the Group class). The quota is -1
+                    for no limit.
+
+                cache <capacity> <cold cost> <half life>
+                    Adds a refill cost to every dispatch, based on how recently the process
+                    ran on the CPU (see the WarmthCache class). Without it, the switch
+                    overheads are flat.
+    */
+    void read_directives(std::istream& input);
+
+    /*
+        read_process(input):
+            Reads in a process from the simulation file. Called by read for each process
+            that is provided in the simulation file.
+    */
+    std::shared_ptr<Process> read_process(std::istream& input);
+
+    /*
+        read_thread(input, thread_id, process_id, priority):
+            Reads in a thread from the simulation file. Called by read_process
+            for each thread in a process, as provided by the simulation file.
+
+            Deadlines are optional. An extra value on the thread's "arrival bursts" line
+            is a relative deadline for each of its CPU bursts, and an extra value at the end
+            of a burst line is the deadline for that line's CPU burst only.
+    */
+    std::shared_ptr<Thread> read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority);
+};
+
+#endif
@@ -1,8 +1,44 @@
 #include "utilities/flags/flags.hpp"
 
+#include <filesystem>
+#include <glob.h>
+#include <sstream>
+
+/*
+    Values returned by getopt_long for options that only have a long form.
+*/
+enum LongOnlyFlags {
+    AGING_FLAG = 256,
+    AFFINITY_FLAG,
+    PROCESS_QUANTUM_FLAG,
+    OVERHEAD_TARGET_FLAG,
+    ALPHA_FLAG,
+    HISTORY_FLAG,
+    SCHEDULER_PLUGIN_FLAG,
+    CPUS_FLAG,
+    BALANCE_FLAG,
+    BALANCE_INTERVAL_FLAG,
+    MIGRATION_COST_FLAG,
+    NUMA_FLAG,
+    PLACEMENT_FLAG,
+    CORE_CLASSES_FLAG,
+    CLASS_PLACEMENT_FLAG,
+    SMT_FLAG,
+    SMT_PLACEMENT_FLAG,
+    SWEEP_FLAG,
+    JOBS_FLAG,
+    OUTPUT_DIR_FLAG,
+    PDES_FLAG,
+    PDES_VERIFY_FLAG
+};
+
 void print_usage() {
     std::cout <<
-        "Usage: cpu-sim [options] filename\n"
+        "Usage: cpu-sim [options] filename...\n"
+        "\n"
+        "Each filename may also be a directory, for every file in it, or a pattern such as\n"
+        "'tests/input/input-*'. With several files, they are simulated at the same time, their\n"
+        "outputs are printed in order, and a summary of them all follows.\n"
         "\n"
         "Options\n"
         "   -h, --help:\n"
@@ -17,6 +53,96 @@ void print_usage() {
         "   -t, --per_thread:\n"
         "       If set, outputs per-thread metrics at the end of the simulation.\n"
         "\n"
+        "   -p, --preemptive:\n"
+        "       If set, a newly ready thread with a higher priority (or, for EDF, an earlier deadline)\n"
+        "       preempts the running thread.\n"
+        "       Only valid for the PRIORITY and EDF algorithms.\n"
+        "\n"
+        "   --aging <value>:\n"
+        "       Promote a waiting thread one priority level for every <value> ticks it spends in the\n"
+        "       ready queue. Must be greater than zero. Only valid for the PRIORITY algorithm.\n"
+        "\n"
+        "   --affinity <value>:\n"
+        "       Prefer a ready thread of the process already on the CPU if it is at most <value>\n"
+        "       places behind the head of its queue. The head is passed over at most <value> times.\n"
+        "       Must be greater than zero. Only valid for the FCFS, RR, ARR and PRIORITY algorithms.\n"
+        "\n"
+        "   --process_quantum <value>:\n"
+        "       The CPU time a process gets per turn with the GANG algorithm. Must be greater than\n"
+        "       zero. Defaults to four time slices.\n"
+        "\n"
+        "   --overhead_target <percent>:\n"
+        "       The largest share of CPU time that dispatch overhead should take with the ARR\n"
+        "       algorithm. Must be between 0 and 100, exclusive. Defaults to 25.\n"
+        "\n"
+        "   --alpha <value>:\n"
+        "       The weight of the latest burst when predicting CPU burst lengths by exponential\n"
+        "       averaging. Must be greater than 0 and at most 1. Defaults to 0.5. Only valid for PSJF.\n"
+        "\n"
+        "   --history <value>:\n"
+        "       Predict CPU burst lengths as the median of each thread's last <value> bursts instead.\n"
+        "       Must be greater than zero. Only valid for PSJF.\n"
+        "\n"
+        "   --cpus <value>:\n"
+        "       The number of CPUs to simulate. They take threads from the same ready queue, and each\n"
+        "       pays its own switch overhead. Must be greater than zero. Defaults to 1.\n"
+        "\n"
+        "   --balance <policy>:\n"
+        "       Give each CPU its own ready queue, balanced with one of these policies:\n"
+        "           none: threads stay on the CPU they were placed on\n"
+        "           steal: a CPU with an empty queue takes a thread from the longest queue\n"
+        "           push: every --balance_interval ticks, threads move from the busiest CPUs\n"
+        "                 to the least busy until they differ by at most one thread\n"
+        "           both: steal and push\n"
+        "       New threads go to the least busy CPU, and threads return to their last CPU.\n"
+        "       Not valid with HFS, whose quotas are for all the CPUs together.\n"
+        "\n"
+        "   --balance_interval <value>:\n"
+        "       How often, in ticks, the imbalance between CPUs is sampled and pushed away.\n"
+        "       Must be greater than zero. Defaults to 20. Only valid with --balance.\n"
+        "\n"
+        "   --migration_cost <value>:\n"
+        "       Extra dispatch time for a thread that last ran on another CPU. Must not be\n"
+        "       negative. Defaults to 0.\n"
+        "\n"
+        "   --numa <path>:\n"
+        "       Simulate the NUMA machine described in the file at <path>, which sets the number of\n"
+        "       nodes, the CPUs on each node, and the extra dispatch time for moving a thread to\n"
+        "       another node and for running a thread away from its process's home node. Cannot be\n"
+        "       combined with --cpus.\n"
+        "\n"
+        "   --placement <policy>:\n"
+        "       Where threads are placed on a NUMA machine:\n"
+        "           spread: on the least busy CPU of any node (default)\n"
+        "           local: on their process's home node, balanced across nodes only as a last resort\n"
+        "           strict: on their process's home node only\n"
+        "       A process's home node is where its first thread was placed. Only valid with --numa\n"
+        "       and --balance.\n"
+        "\n"
+        "   --core_classes <name>:<count>:<speed>,...:\n"
+        "       Simulate CPUs of different speeds, such as big:2:1.0,little:4:0.5. A CPU burst takes\n"
+        "       its length divided by the speed, rounded up, to run. The CPUs are numbered class by\n"
+        "       class. Cannot be combined with --cpus; with --numa, the counts must add up to the\n"
+        "       topology's CPUs.\n"
+        "\n"
+        "   --class_placement <policy>:\n"
+        "       Which class of CPU threads are placed on:\n"
+        "           any: the least busy CPU of any class (default)\n"
+        "           priority: the fastest CPUs for SYSTEM and INTERACTIVE threads, the rest for others\n"
+        "           utilization: the fastest CPUs for threads that have been running at least half\n"
+        "                        the time since they arrived, the rest for others\n"
+        "       Only valid with --core_classes and --balance.\n"
+        "\n"
+        "   --smt <slowdown>:\n"
+        "       Give every CPU two hardware threads, each scheduled like a CPU of its own. While both\n"
+        "       are running, CPU bursts take <slowdown> times longer. Must be at least 1.\n"
+        "\n"
+        "   --smt_placement <policy>:\n"
+        "       How threads are placed on the hardware threads:\n"
+        "           spread: on a CPU with both hardware threads idle first (default)\n"
+        "           isolate: also away from a hardware thread running another process's thread\n"
+        "       Only valid with --smt; isolate also needs --balance.\n"
+        "\n"
         "   -v, --verbose:\n"
         "       If set, outputs all state transitions and scheduling choices.\n"
         "\n"
@@ -25,8 +151,54 @@ void print_usage() {
         "           FCFS: first-come, first-served (default)\n"
         "           RR: round-robin scheduling\n"
         "           PRIORITY: priority scheduling\n"
+        "           EDF: earliest-deadline-first scheduling\n"
+        "           GANG: round robin over processes, running a process's threads back-to-back\n"
+        "           ARR: round robin with a quantum adapted to recent CPU bursts\n"
+        "           HFS: fair share between the groups in the simulation file, with CPU quotas\n"
+        "           PRIORITY_RR: round robin within each priority level\n"
+        "           PRIORITY_CFS: fair share between the threads of each priority level\n"
+        "           TENANT_RR: fair share between groups (without quotas), round robin within them\n"
+        "           TENANT_CFS: fair share between groups (without quotas) and within them\n"
+        "           PSJF: shortest-job-first using predicted CPU burst lengths\n"
         "           MLFQ: multilevel feedback queue\n"
-        "           CUSTOM: A custom algorithm\n";
+        "           CUSTOM: A custom algorithm\n"
+        "\n"
+        "   --scheduler-plugin <path>:\n"
+        "       Load the scheduling algorithm from the shared object at <path> instead (for example,\n"
+        "       ./bin/plugins/lottery.so). Cannot be combined with -a. See scheduler_plugin.h.\n"
+        "\n"
+        "   --sweep <parameter>=<values>:\n"
+        "       Run the simulation once for every combination of the swept parameters, in parallel,\n"
+        "       and print one CSV line of metrics per run, in order. Can be given once for each of:\n"
+        "           algorithm: a comma-separated list of algorithms (instead of -a)\n"
+        "           time_slice: time slices (instead of -s), only used by the algorithms that\n"
+        "                       take one\n"
+        "           thread_overhead, process_overhead: switch overheads that replace the ones in\n"
+        "                                              the simulation file\n"
+        "       Numbers are comma-separated values or ranges, such as 1,2,5:50:5 (5 to 50 by 5).\n"
+        "       Cannot be combined with -v, -t or --scheduler-plugin.\n"
+        "\n"
+        "   --jobs <value>:\n"
+        "       The number of simulations a sweep, or a run of several files, runs at the same\n"
+        "       time, or the number of workers of --pdes. Must be greater than zero. Defaults to\n"
+        "       the number of hardware threads.\n"
+        "\n"
+        "   --pdes:\n"
+        "       Simulate each CPU as a logical process with its own event queue, in parallel,\n"
+        "       synchronizing them only when threads arrive. The results are the same as\n"
+        "       without it; with -m, how the work was split up is printed.\n"
+        "       Only valid with --balance none, and not with -v, -p, --smt, --numa,\n"
+        "       --class_placement, --scheduler-plugin, PSJF, --sweep or several files.\n"
+        "\n"
+        "   --pdes-verify:\n"
+        "       Also run the sequential engine, and print with the metrics whether its results\n"
+        "       are the same and how much faster the parallel engine was. Only valid with\n"
+        "       --pdes and -m.\n"
+        "\n"
+        "   --output_dir <path>:\n"
+        "       Write each file's output to its own file in the directory at <path> instead,\n"
+        "       named like the files in tests/output, such as output-rr-s6-2.v for\n"
+        "       -v -a RR -s 6 tests/input/input-2.\n";
 }
 
 
@@ -42,16 +214,47 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         {"verbose",     no_argument,        0, 'v'},
         {"algorithm",   required_argument,  0, 'a'},
         {"time_slice",  required_argument,  0, 's'},
+        {"preemptive",  no_argument,        0, 'p'},
+        {"aging",       required_argument,  0, AGING_FLAG},
+        {"affinity",    required_argument,  0, AFFINITY_FLAG},
+        {"process_quantum", required_argument, 0, PROCESS_QUANTUM_FLAG},
+        {"overhead_target", required_argument, 0, OVERHEAD_TARGET_FLAG},
+        {"alpha",       required_argument,  0, ALPHA_FLAG},
+        {"history",     required_argument,  0, HISTORY_FLAG},
+        {"scheduler-plugin", required_argument, 0, SCHEDULER_PLUGIN_FLAG},
+        {"cpus",        required_argument,  0, CPUS_FLAG},
+        {"balance",     required_argument,  0, BALANCE_FLAG},
+        {"balance_interval", required_argument, 0, BALANCE_INTERVAL_FLAG},
+        {"migration_cost", required_argument, 0, MIGRATION_COST_FLAG},
+        {"numa",        required_argument,  0, NUMA_FLAG},
+        {"placement",   required_argument,  0, PLACEMENT_FLAG},
+        {"core_classes", required_argument, 0, CORE_CLASSES_FLAG},
+        {"class_placement", required_argument, 0, CLASS_PLACEMENT_FLAG},
+        {"smt",         required_argument,  0, SMT_FLAG},
+        {"smt_placement", required_argument, 0, SMT_PLACEMENT_FLAG},
+        {"sweep",       required_argument,  0, SWEEP_FLAG},
+        {"jobs",        required_argument,  0, JOBS_FLAG},
+        {"output_dir",  required_argument,  0, OUTPUT_DIR_FLAG},
+        {"pdes",        no_argument,        0, PDES_FLAG},
+        {"pdes-verify", no_argument,        0, PDES_VERIFY_FLAG},
         {"help",        no_argument,        0, 'h'},
         {0, 0, 0, 0}
     };
 
+    bool overhead_target_set = false;
+    bool predictor_set = false;
+    bool balance_interval_set = false;
+    bool cpus_set = false;
+    bool placement_set = false;
+    bool class_placement_set = false;
+    bool smt_placement_set = false;
+    bool algorithm_set = false;
     int option_index;
-    char flag_char;
+    int flag_char;
 
     // Parse flags entered by the user.
     while (true) {
-        flag_char = getopt_long(argc, argv, "-s:tvhma:", flag_options, &option_index);
+        flag_char = getopt_long(argc, argv, "-s:tvhma:p", flag_options, &option_index);
 
         // Detect the end of the options.
         if (flag_char == -1) {
@@ -73,6 +276,178 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
 
             case 'a':
                 flags.scheduler = get_scheduler();
+                algorithm_set = true;
+                break;
+
+            case 'p':
+                flags.preemptive = true;
+                break;
+
+            case AGING_FLAG:
+                try {
+                    flags.aging_threshold = std::stoi(optarg);
+                    if (flags.aging_threshold <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case AFFINITY_FLAG:
+                try {
+                    flags.affinity_window = std::stoi(optarg);
+                    if (flags.affinity_window <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case PROCESS_QUANTUM_FLAG:
+                try {
+                    flags.process_quantum = std::stoi(optarg);
+                    if (flags.process_quantum <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case OVERHEAD_TARGET_FLAG:
+                try {
+                    flags.overhead_target = std::stod(optarg);
+                    if (flags.overhead_target <= 0.0 || flags.overhead_target >= 100.0) { return 1; }
+                    overhead_target_set = true;
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case ALPHA_FLAG:
+                try {
+                    flags.alpha = std::stod(optarg);
+                    if (flags.alpha <= 0.0 || flags.alpha > 1.0) { return 1; }
+                    predictor_set = true;
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case HISTORY_FLAG:
+                try {
+                    flags.history = std::stoi(optarg);
+                    if (flags.history <= 0) { return 1; }
+                    predictor_set = true;
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case SCHEDULER_PLUGIN_FLAG:
+                flags.scheduler_plugin = optarg;
+                break;
+
+            case CPUS_FLAG:
+                try {
+                    flags.cpus = std::stoi(optarg);
+                    if (flags.cpus <= 0) { return 1; }
+                    cpus_set = true;
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case BALANCE_FLAG:
+                flags.balance = optarg;
+                if (flags.balance != "none" && flags.balance != "steal" && flags.balance != "push" && flags.balance != "both") {
+                    return 1;
+                }
+                break;
+
+            case BALANCE_INTERVAL_FLAG:
+                try {
+                    flags.balance_interval = std::stoi(optarg);
+                    if (flags.balance_interval <= 0) { return 1; }
+                    balance_interval_set = true;
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case MIGRATION_COST_FLAG:
+                try {
+                    flags.migration_cost = std::stoi(optarg);
+                    if (flags.migration_cost < 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case NUMA_FLAG:
+                flags.numa = optarg;
+                break;
+
+            case PLACEMENT_FLAG:
+                flags.placement = optarg;
+                if (flags.placement != "spread" && flags.placement != "local" && flags.placement != "strict") {
+                    return 1;
+                }
+                placement_set = true;
+                break;
+
+            case CORE_CLASSES_FLAG:
+                if (!parse_core_classes(optarg, flags.core_classes)) {
+                    return 1;
+                }
+                break;
+
+            case CLASS_PLACEMENT_FLAG:
+                flags.class_placement = optarg;
+                if (flags.class_placement != "any" && flags.class_placement != "priority" && flags.class_placement != "utilization") {
+                    return 1;
+                }
+                class_placement_set = true;
+                break;
+
+            case SMT_FLAG:
+                try {
+                    flags.smt = std::stod(optarg);
+                    if (flags.smt < 1.0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case SMT_PLACEMENT_FLAG:
+                flags.smt_placement = optarg;
+                if (flags.smt_placement != "spread" && flags.smt_placement != "isolate") {
+                    return 1;
+                }
+                smt_placement_set = true;
+                break;
+
+            case SWEEP_FLAG:
+                if (!parse_sweep(optarg, flags)) {
+                    return 1;
+                }
+                break;
+
+            case JOBS_FLAG:
+                try {
+                    flags.jobs = std::stoi(optarg);
+                    if (flags.jobs <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case OUTPUT_DIR_FLAG:
+                flags.output_dir = optarg;
+                break;
+
+            case PDES_FLAG:
+                flags.pdes = true;
+                break;
+
+            case PDES_VERIFY_FLAG:
+                flags.pdes_verify = true;
                 break;
 
             case 'h':
@@ -86,9 +461,10 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
                 } catch (...) {
                     return 1;
                 }
+                break;
 
             case 1:
-                flags.filename = optarg;
+                flags.filenames.push_back(optarg);
                 break;
 
             default:
@@ -96,9 +472,17 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         }
     }
 
-    if (flags.filename == "") {
+    if (!expand_inputs(flags.filenames)) {
         return 1;
     }
+    flags.filename = flags.filenames.front();
+
+    if (flags.scheduler_plugin != "") {
+        if (flags.scheduler != "") {
+            return 1;
+        }
+        flags.scheduler = "PLUGIN";
+    }
 
     if (flags.scheduler == "") {
         flags.scheduler = "FCFS";
@@ -108,7 +492,102 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         return 1;
     }
 
-    if ((flags.scheduler == "FCFS" || flags.scheduler == "PRIORITY") && (flags.time_slice != -1)) {
+    // With a sweep over algorithms, the algorithm's flags must suit every one of them.
+    if (flags.sweep) {
+        if ((algorithm_set && !flags.sweep_algorithms.empty()) || (flags.time_slice != -1 && !flags.sweep_time_slices.empty())) {
+            return 1;
+        }
+        if (flags.verbose || flags.per_thread || flags.scheduler_plugin != "") {
+            return 1;
+        }
+        if (flags.filenames.size() > 1) {
+            return 1;
+        }
+    } else if (flags.jobs != 0 && flags.filenames.size() == 1 && !flags.pdes) {
+        return 1;
+    }
+
+    std::vector<std::string> schedulers = flags.sweep_algorithms;
+    if (schedulers.empty()) {
+        schedulers.push_back(flags.scheduler);
+    }
+
+    for (const std::string& scheduler : schedulers) {
+        if (!uses_time_slice(scheduler) && (flags.time_slice != -1)) {
+            return 1;
+        }
+
+        if (flags.preemptive && scheduler != "PRIORITY" && scheduler != "EDF") {
+            return 1;
+        }
+
+        if (flags.aging_threshold != -1 && scheduler != "PRIORITY") {
+            return 1;
+        }
+
+        if (predictor_set && scheduler != "PSJF") {
+            return 1;
+        }
+
+        if (overhead_target_set && scheduler != "ARR") {
+            return 1;
+        }
+
+        if (flags.process_quantum != -1 && scheduler != "GANG") {
+            return 1;
+        }
+
+        // Each CPU's own ready queue has its own scheduler, which would give every group its
+        // quota once per CPU.
+        if (flags.balance != "" && scheduler == "HFS") {
+            return 1;
+        }
+
+        if (flags.affinity_window != 0 && scheduler != "FCFS" && scheduler != "RR" && scheduler != "PRIORITY" && scheduler != "ARR") {
+            return 1;
+        }
+    }
+
+    if (balance_interval_set && flags.balance == "") {
+        return 1;
+    }
+
+    if (cpus_set && flags.numa != "") {
+        return 1;
+    }
+
+    if (placement_set && (flags.numa == "" || flags.balance == "")) {
+        return 1;
+    }
+
+    if (cpus_set && !flags.core_classes.empty()) {
+        return 1;
+    }
+
+    if (class_placement_set && (flags.core_classes.empty() || flags.balance == "")) {
+        return 1;
+    }
+
+    if (smt_placement_set && (flags.smt == 0.0 || (flags.smt_placement == "isolate" && flags.balance == ""))) {
+        return 1;
+    }
+
+    // The parallel engine needs CPUs that never touch each other's ready queues or threads
+    // between arrivals. It cannot print verbose output in the order of the events, or add
+    // up PSJF's floating point prediction errors in the same order.
+    if (flags.pdes) {
+        if (flags.balance != "none" || flags.smt > 0.0 || flags.numa != "" || flags.class_placement != "any") {
+            return 1;
+        }
+        if (flags.verbose || flags.preemptive || flags.scheduler == "PLUGIN" || flags.scheduler == "PSJF") {
+            return 1;
+        }
+        if (flags.sweep || flags.filenames.size() > 1) {
+            return 1;
+        }
+    }
+
+    if (flags.pdes_verify && (!flags.pdes || !flags.metrics)) {
         return 1;
     }
 
@@ -116,11 +595,155 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
 }
 
 
+bool parse_core_classes(const std::string& text, std::vector<CoreClass>& classes) {
+    classes.clear();
+
+    std::stringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        std::stringstream fields(item);
+        std::string name, count, speed;
+        if (!std::getline(fields, name, ':') || !std::getline(fields, count, ':') || !std::getline(fields, speed) || name.empty()) {
+            return false;
+        }
+
+        try {
+            CoreClass core_class(name, std::stoi(count), std::stod(speed));
+            if (core_class.count <= 0 || core_class.speed <= 0.0) {
+                return false;
+            }
+            classes.push_back(core_class);
+        } catch (...) {
+            return false;
+        }
+    }
+    return !classes.empty();
+}
+
+
+bool expand_inputs(std::vector<std::string>& filenames) {
+    std::vector<std::string> expanded;
+
+    for (const std::string& filename : filenames) {
+        std::error_code error;
+        if (std::filesystem::is_directory(filename, error)) {
+            // Every visible file in the directory, in order of name.
+            std::vector<std::string> files;
+            for (const auto& entry : std::filesystem::directory_iterator(filename, error)) {
+                if (entry.is_regular_file() && entry.path().filename().string()[0] != '.') {
+                    files.push_back(entry.path().string());
+                }
+            }
+            std::sort(files.begin(), files.end());
+            expanded.insert(expanded.end(), files.begin(), files.end());
+        } else if (!std::filesystem::exists(filename, error) && filename.find_first_of("*?[") != std::string::npos) {
+            // A pattern the shell did not expand. glob sorts the matches.
+            glob_t matches;
+            if (glob(filename.c_str(), 0, nullptr, &matches) == 0) {
+                expanded.insert(expanded.end(), matches.gl_pathv, matches.gl_pathv + matches.gl_pathc);
+            }
+            globfree(&matches);
+        } else {
+            expanded.push_back(filename);
+        }
+    }
+
+    if (expanded.empty()) {
+        return false;
+    }
+    filenames = expanded;
+    return true;
+}
+
+bool uses_time_slice(const std::string& scheduler) {
+    return scheduler != "FCFS" && scheduler != "PRIORITY" && scheduler != "EDF" && scheduler != "PSJF";
+}
+
+/*
+    parse_values(text, values):
+        Parses a comma-separated list of numbers and first:last[:step] ranges into values.
+        Returns false if it is invalid or any value is negative.
+*/
+static bool parse_values(const std::string& text, std::vector<int>& values) {
+    values.clear();
+
+    std::stringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        std::stringstream fields(item);
+        std::vector<int> numbers;
+        for (std::string field; std::getline(fields, field, ':');) {
+            try {
+                size_t used;
+                numbers.push_back(std::stoi(field, &used));
+                if (used != field.size() || numbers.back() < 0) {
+                    return false;
+                }
+            } catch (...) {
+                return false;
+            }
+        }
+
+        if (numbers.size() == 1) {
+            values.push_back(numbers[0]);
+        } else if (numbers.size() == 2 || numbers.size() == 3) {
+            int step = (numbers.size() == 3) ? numbers[2] : 1;
+            if (step <= 0 || numbers[1] < numbers[0]) {
+                return false;
+            }
+            for (int value = numbers[0]; value <= numbers[1]; value += step) {
+                values.push_back(value);
+            }
+        } else {
+            return false;
+        }
+    }
+    return !values.empty();
+}
+
+bool parse_sweep(const std::string& text, FlagOptions& flags) {
+    size_t equals = text.find('=');
+    if (equals == std::string::npos) {
+        return false;
+    }
+    std::string parameter = text.substr(0, equals);
+    std::string values = text.substr(equals + 1);
+    flags.sweep = true;
+
+    if (parameter == "algorithm") {
+        if (!flags.sweep_algorithms.empty()) {
+            return false;
+        }
+
+        std::stringstream list(values);
+        std::string item;
+        while (std::getline(list, item, ',')) {
+            std::string scheduler = parse_scheduler(item);
+            if (scheduler == "ERROR") {
+                return false;
+            }
+            flags.sweep_algorithms.push_back(scheduler);
+        }
+        return !flags.sweep_algorithms.empty();
+    } else if (parameter == "time_slice") {
+        return flags.sweep_time_slices.empty() && parse_values(values, flags.sweep_time_slices) &&
+            std::find(flags.sweep_time_slices.begin(), flags.sweep_time_slices.end(), 0) == flags.sweep_time_slices.end();
+    } else if (parameter == "thread_overhead") {
+        return flags.sweep_thread_overheads.empty() && parse_values(values, flags.sweep_thread_overheads);
+    } else if (parameter == "process_overhead") {
+        return flags.sweep_process_overheads.empty() && parse_values(values, flags.sweep_process_overheads);
+    }
+    return false;
+}
+
 std::string get_scheduler() {
-    std::string input(optarg);
+    return parse_scheduler(optarg);
+}
+
+std::string parse_scheduler(const std::string& input) {
     std::string input_algorithm = input;
     std::transform(input_algorithm.begin(), input_algorithm.end(), input_algorithm.begin(), ::toupper);
-    std::string valid_algorithms[] = {"FCFS", "RR", "PRIORITY", "MLFQ", "CUSTOM"};
+    std::string valid_algorithms[] = {"FCFS", "RR", "PRIORITY", "EDF", "GANG", "ARR", "HFS", "PRIORITY_RR", "PRIORITY_CFS", "TENANT_RR", "TENANT_CFS", "PSJF", "MLFQ", "CUSTOM"};
 
     bool valid = std::find(std::begin(valid_algorithms), std::end(valid_algorithms), input_algorithm) != std::end(valid_algorithms);
 
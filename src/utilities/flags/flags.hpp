@@ -7,6 +7,9 @@
 #include <getopt.h>
 #include <iostream>
 #include <string>
+#include <vector>
+
+#include "types/core_class/core_class.hpp"
 
 /*
     FlagOptions:
@@ -29,6 +32,22 @@ public:
     */
     std::string filename = "";
 
+    /*
+        filenames:
+            Every file to simulate, after directories and patterns are expanded, in order.
+            filename is the first. With more than one, they are simulated as a batch.
+    */
+    std::vector<std::string> filenames;
+
+    /*
+        output_dir:
+            The directory to write each file's output to, named like the files in
+            tests/output, or empty to print it.
+
+            Set with the --output_dir flag.
+    */
+    std::string output_dir = "";
+
     /*
         verbose:
             Whether or not the simulation should print verbose, per-state transitions.
@@ -63,6 +82,72 @@ public:
     */
     int time_slice = -1;
 
+    /*
+        preemptive:
+            Whether a newly ready thread with a higher priority (or, for EDF, an earlier
+            deadline) should preempt the running thread. Only valid for the PRIORITY and
+            EDF algorithms.
+
+            Set to true with the -p, --preemptive flag.
+    */
+    bool preemptive = false;
+
+    /*
+        aging_threshold:
+            How long a thread may wait in the ready queue before the PRIORITY algorithm
+            starts promoting it. Every full threshold waited raises it one level. A value
+            of -1 disables aging.
+
+            Set with the --aging flag.
+    */
+    int aging_threshold = -1;
+
+    /*
+        affinity_window:
+            How far behind the head of a ready queue the FCFS, RR, ARR and PRIORITY algorithms look
+            for a thread of the process already on the CPU, and how many times the head may be
+            passed over for one. 0 disables affinity.
+
+            Set with the --affinity flag.
+    */
+    int affinity_window = 0;
+
+    /*
+        process_quantum:
+            How much CPU time a process gets per turn with the GANG algorithm. A value
+            of -1 uses four time slices.
+
+            Set with the --process_quantum flag.
+    */
+    int process_quantum = -1;
+
+    /*
+        overhead_target:
+            The largest percentage of CPU time that dispatch overhead should take with
+            the ARR algorithm. Between 0 and 100, exclusive.
+
+            Set with the --overhead_target flag.
+    */
+    double overhead_target = 25.0;
+
+    /*
+        alpha:
+            The weight of the most recent burst when predicting CPU burst lengths by
+            exponential averaging. Between 0 and 1.
+
+            Set with the --alpha flag.
+    */
+    double alpha = 0.5;
+
+    /*
+        history:
+            If greater than zero, CPU burst lengths are predicted as the median of each
+            thread's last history bursts instead of by exponential averaging.
+
+            Set with the --history flag.
+    */
+    int history = 0;
+
     /*
         scheduler:
             A string representing the scheduling algorithm that the
@@ -71,6 +156,163 @@ public:
             Set with the -a, --algorithm flag.
     */
     std::string scheduler = "";
+
+    /*
+        scheduler_plugin:
+            The path of a shared object to load the scheduling algorithm from (see
+            scheduler_plugin.h). When set, scheduler is "PLUGIN".
+
+            Set with the --scheduler-plugin flag.
+    */
+    std::string scheduler_plugin = "";
+
+    /*
+        cpus:
+            The number of CPUs (cores) to simulate. They share the scheduler's ready queue.
+
+            Set with the --cpus flag, or from the topology file given with --numa or the
+            classes given with --core_classes.
+    */
+    int cpus = 1;
+
+    /*
+        numa:
+            The path of a file describing how the CPUs are split into NUMA nodes (see the
+            Topology class), or empty if they are all on one node.
+
+            Set with the --numa flag.
+    */
+    std::string numa = "";
+
+    /*
+        placement:
+            Where threads are placed on a NUMA machine with per-CPU ready queues:
+                "spread": on any CPU, ignoring the nodes
+                "local": on their process's home node, moving to another node only if load
+                         balancing finds nothing to move within a node
+                "strict": on their process's home node only
+
+            Set with the --placement flag.
+    */
+    std::string placement = "spread";
+
+    /*
+        core_classes:
+            The kinds of CPUs, fast and slow, that the simulated machine has. Empty if every CPU
+            runs at the reference speed.
+
+            Set with the --core_classes flag.
+    */
+    std::vector<CoreClass> core_classes;
+
+    /*
+        class_placement:
+            Which class of CPU threads are placed on, with per-CPU ready queues:
+                "any": the least loaded CPU, whatever its class
+                "priority": the fastest CPUs for SYSTEM and INTERACTIVE threads, the others for
+                            NORMAL and BATCH threads
+                "utilization": the fastest CPUs for threads that have been running for at
+                               least half the time since they arrived, the others otherwise
+
+            Set with the --class_placement flag.
+    */
+    std::string class_placement = "any";
+
+    /*
+        smt:
+            If greater than zero, every CPU has two hardware threads, and a CPU burst runs this
+            many times slower while both are running. 0 disables SMT.
+
+            Set with the --smt flag.
+    */
+    double smt = 0.0;
+
+    /*
+        smt_placement:
+            How threads are placed on the hardware threads with SMT:
+                "spread": on a CPU with both hardware threads idle, if there is one
+                "isolate": also, with per-CPU ready queues, away from a hardware thread that
+                           is running a thread of another process
+
+            Set with the --smt_placement flag.
+    */
+    std::string smt_placement = "spread";
+
+    /*
+        balance:
+            The load balancing policy between the ready queues of the CPUs: "none", "steal",
+            "push" or "both". Empty if the CPUs share one ready queue, which is the default.
+
+            Set with the --balance flag.
+    */
+    std::string balance = "";
+
+    /*
+        balance_interval:
+            How often, in ticks, the imbalance between the CPUs is sampled and, with push
+            migration, corrected.
+
+            Set with the --balance_interval flag.
+    */
+    int balance_interval = 20;
+
+    /*
+        migration_cost:
+            The extra dispatch overhead for a thread that last ran on another CPU.
+
+            Set with the --migration_cost flag.
+    */
+    int migration_cost = 0;
+
+    /*
+        thread_switch_overhead, process_switch_overhead:
+            If not -1, replace the switch overheads from the simulation file.
+
+            Set for each run of a sweep (see sweep_thread_overheads).
+    */
+    int thread_switch_overhead = -1;
+    int process_switch_overhead = -1;
+
+    /*
+        sweep:
+            Whether to run a sweep: the simulation once for every combination of the values
+            in sweep_algorithms, sweep_time_slices, sweep_thread_overheads and
+            sweep_process_overheads. An empty list leaves that parameter as it is.
+
+            Set with the --sweep flag, which fills one of the lists.
+    */
+    bool sweep = false;
+    std::vector<std::string> sweep_algorithms;
+    std::vector<int> sweep_time_slices;
+    std::vector<int> sweep_thread_overheads;
+    std::vector<int> sweep_process_overheads;
+
+    /*
+        jobs:
+            How many simulations a sweep runs at the same time, or 0 for one per hardware
+            thread. With pdes, how many workers run the logical processes instead.
+
+            Set with the --jobs flag.
+    */
+    int jobs = 0;
+
+    /*
+        pdes:
+            Whether to run the simulation with the parallel engine (see ParallelEngine), which
+            simulates the CPUs as logical processes on --jobs workers.
+
+            Set with the --pdes flag.
+    */
+    bool pdes = false;
+
+    /*
+        pdes_verify:
+            Whether to run the sequential engine after the parallel one, to check that the
+            results are the same and to time the two.
+
+            Set with the --pdes-verify flag.
+    */
+    bool pdes_verify = false;
 };
 
 /*
@@ -87,10 +329,44 @@ void print_usage();
 */
 int parse_flags(int argc, char* const argv[], FlagOptions& flags);
 
+/*
+    parse_core_classes(text, classes):
+        Parses the --core_classes list into classes. Returns false if it is invalid.
+*/
+bool parse_core_classes(const std::string& text, std::vector<CoreClass>& classes);
+
+/*
+    parse_sweep(text, flags):
+        Parses one --sweep <parameter>=<values> into the flags. Returns false if it is
+        invalid, or the parameter was already swept.
+*/
+bool parse_sweep(const std::string& text, FlagOptions& flags);
+
+/*
+    expand_inputs(filenames):
+        Replaces each directory in filenames with the files in it, and each pattern that
+        is not a file with the files that match it, both sorted by name. Returns false if
+        that leaves no files.
+*/
+bool expand_inputs(std::vector<std::string>& filenames);
+
+/*
+    uses_time_slice(scheduler):
+        Whether the scheduling algorithm takes a time slice.
+*/
+bool uses_time_slice(const std::string& scheduler);
+
 /*
     get_scheduler();
         Return a string denoting the type of scheduler to use.
 */
 std::string get_scheduler();
 
+/*
+    parse_scheduler(input);
+        Return the scheduling algorithm with the given name, in upper case, or "ERROR" if
+        there is none.
+*/
+std::string parse_scheduler(const std::string& input);
+
 #endif
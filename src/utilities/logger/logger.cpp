@@ -1,5 +1,6 @@
 #include "utilities/logger/logger.hpp"
 
+#include <cmath>
 #include <cstdio>
 #include <memory>
 #include <sstream>
@@ -29,7 +30,7 @@ inline const char* PROCESS_PRIORITY_MAP[4] = {
 };
 
 
-inline const char* EVENT_MAP[8] = {
+inline const char* EVENT_MAP[9] = {
     "THREAD_ARRIVED",
     "THREAD_DISPATCH_COMPLETED",
     "PROCESS_DISPATCH_COMPLETED",
@@ -37,7 +38,8 @@ inline const char* EVENT_MAP[8] = {
     "IO_BURST_COMPLETED",
     "THREAD_COMPLETED",
     "THREAD_PREEMPTED",
-    "DISPATCHER_INVOKED"
+    "DISPATCHER_INVOKED",
+    "LOAD_BALANCE"
 };
 
 void Logger::print_state_transition(const std::shared_ptr<Event> event, ThreadState before_state, ThreadState after_state) const {
@@ -50,6 +52,10 @@ void Logger::print_state_transition(const std::shared_ptr<Event> event, ThreadSt
         Transitioned from NEW to READY
     */
 
+    if (!this->verbose) {
+        return;
+    }
+
     std::string message = fmt::format("Transitioned from {} to {}", STATE_MAP[before_state], STATE_MAP[after_state]);
 
     print_verbose(event, event->thread, message);
@@ -61,12 +67,25 @@ void Logger::print_verbose(const std::shared_ptr<Event> event, std::shared_ptr<T
         return;
     }
 
-    std::string verbose_message = fmt::format("At time {}:\n", event->time);
+    std::string verbose_message;
+    if (this->cpus > 1 && event->cpu >= 0) {
+        verbose_message = fmt::format("At time {} on CPU {}:\n", event->time, event->cpu);
+    } else {
+        verbose_message = fmt::format("At time {}:\n", event->time);
+    }
     verbose_message += fmt::format("    {}\n", EVENT_MAP[event->type]);
     verbose_message += fmt::format("    Thread {} in process {} [{}]\n", thread->thread_id, thread->process_id, PROCESS_PRIORITY_MAP[thread->priority]);
     verbose_message += fmt::format("    {}\n\n", message);
 
-    std::cout << verbose_message;
+    *this->out << verbose_message;
+}
+
+void Logger::print_scheduling_decision(const std::shared_ptr<Event> event, const SchedulingDecision& decision) const {
+    if (!this->verbose) {
+        return;
+    }
+
+    print_verbose(event, decision.thread, decision.explain());
 }
 
 void Logger::print_per_thread_metrics(std::shared_ptr<Process> process) const {
@@ -86,7 +105,7 @@ void Logger::print_per_thread_metrics(std::shared_ptr<Process> process) const {
     std::string message;
 
     message = fmt::format("Process {} [{}]:\n", process->process_id, PROCESS_PRIORITY_MAP[process->priority]);
-    std::cout << message;
+    *this->out << message;
 
     for (auto thread : process->threads) {
 
@@ -98,9 +117,9 @@ void Logger::print_per_thread_metrics(std::shared_ptr<Process> process) const {
         thread_message += fmt::format("I/O: {:<6} ", thread->io_time);
         thread_message += fmt::format("TRT: {:<6} ", thread->turnaround_time());
         thread_message += fmt::format("END: {:<6}\n", thread->end_time);
-        std::cout << thread_message;
+        *this->out << thread_message;
     }
-    std::cout << "\n";
+    *this->out << "\n";
 }
 
 
@@ -150,7 +169,7 @@ void Logger::print_simulation_metrics(SystemStats stats) const {
         process_type_message += fmt::format("    {:<22} {:>8.{}f}\n", "Avg. response time:", stats.avg_thread_response_times[i], 2);
         process_type_message += fmt::format("    {:<22} {:>8.{}f}\n\n", "Avg. turnaround time:", stats.avg_thread_turnaround_times[i], 2);
 
-        std::cout << process_type_message;
+        *this->out << process_type_message;
     }
 
     std::string summary_message;
@@ -165,5 +184,465 @@ void Logger::print_simulation_metrics(SystemStats stats) const {
     summary_message += fmt::format("{:<22}{:>11.{}f}%\n", "CPU utilization:", stats.cpu_utilization, 2);
     summary_message += fmt::format("{:<22}{:>11.{}f}%\n", "CPU efficiency:", stats.cpu_efficiency, 2);
 
-    std::cout << summary_message << std::endl;
+    *this->out << summary_message << std::endl;
+}
+
+
+void Logger::print_scheduler_metrics(std::string summary) const {
+    if (!this->metrics || summary.empty()) {
+        return;
+    }
+
+    *this->out << summary << std::endl;
+}
+
+void Logger::print_wait_metrics(SystemStats stats) const {
+    /*
+    This prints something like this:
+
+    MAX. WAIT TIMES:
+        SYSTEM:                       12
+        INTERACTIVE:                  40
+        NORMAL:                      215
+        BATCH:                       730
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    std::string message = "MAX. WAIT TIMES:\n";
+
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        message += fmt::format("    {:<22} {:>8}\n", fmt::format("{}:", PROCESS_PRIORITY_MAP[i]), stats.max_thread_wait_times[i]);
+    }
+
+    *this->out << message << std::endl;
+}
+
+
+void Logger::print_prediction_metrics(std::shared_ptr<Process> process) const {
+    /*
+    This prints something like this:
+
+    Process 1 [SYSTEM] burst predictions:
+        Thread  0:    BURSTS: 8      MAE: 6.41   RMSE: 8.02   BIAS: 1.75
+        Thread  1:    BURSTS: 5      MAE: 3.90   RMSE: 4.47   BIAS: -0.60
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    std::string message = fmt::format("Process {} [{}] burst predictions:\n", process->process_id, PROCESS_PRIORITY_MAP[process->priority]);
+
+    for (auto thread : process->threads) {
+        const BurstPredictor& predictor = thread->predictor;
+
+        message += fmt::format("    Thread {:>2}:    ", thread->thread_id);
+        message += fmt::format("BURSTS: {:<6} ", predictor.samples);
+        message += fmt::format("MAE: {:<6.2f} ", predictor.mean_abs_error());
+        message += fmt::format("RMSE: {:<6.2f} ", predictor.root_mean_squared_error());
+        message += fmt::format("BIAS: {:<6.2f}\n", predictor.bias());
+    }
+
+    *this->out << message << "\n";
+}
+
+void Logger::print_prediction_summary(SystemStats stats) const {
+    /*
+    This prints something like this:
+
+    SYSTEM PREDICTIONS:
+        Predicted bursts:            24
+        Mean abs. error:           5.21
+        RMS error:                 6.90
+        Mean error (bias):         0.42
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        size_t samples = stats.prediction_samples[i];
+        double divisor = (samples == 0) ? 1.0 : (double) samples;
+
+        std::string message;
+
+        message = fmt::format("{} PREDICTIONS:\n", PROCESS_PRIORITY_MAP[i]);
+        message += fmt::format("    {:<22} {:>8}\n", "Predicted bursts:", samples);
+        message += fmt::format("    {:<22} {:>8.{}f}\n", "Mean abs. error:", stats.prediction_abs_error[i] / divisor, 2);
+        message += fmt::format("    {:<22} {:>8.{}f}\n", "RMS error:", std::sqrt(stats.prediction_squared_error[i] / divisor), 2);
+        message += fmt::format("    {:<22} {:>8.{}f}\n\n", "Mean error (bias):", stats.prediction_error[i] / divisor, 2);
+
+        *this->out << message;
+    }
+    *this->out << std::flush;
+}
+
+void Logger::print_affinity_metrics(SystemStats stats) const {
+    /*
+    This prints something like this:
+
+    AFFINITY:
+        Affinity dispatches:         31
+        Dispatch time saved:        992
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    std::string message = "AFFINITY:\n";
+    message += fmt::format("    {:<22} {:>8}\n", "Affinity dispatches:", stats.affinity_dispatches);
+    message += fmt::format("    {:<22} {:>8}\n", "Dispatch time saved:", stats.affinity_time_saved);
+
+    *this->out << message << std::endl;
+}
+
+void Logger::print_deadline_metrics(SystemStats stats) const {
+    /*
+    This prints something like this:
+
+    SYSTEM DEADLINES:
+        Bursts with deadlines:       14
+        Deadline misses:              2
+        Avg. tardiness:            1.43
+
+    ...
+
+    BURST LATENESS:
+        50th percentile:            -18
+        90th percentile:              3
+        99th percentile:             12
+        Maximum:                     12
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        double avg_tardiness = 0.0;
+        if (stats.deadline_jobs[i] != 0) {
+            avg_tardiness = (double) stats.total_tardiness[i] / stats.deadline_jobs[i];
+        }
+
+        std::string message;
+
+        message = fmt::format("{} DEADLINES:\n", PROCESS_PRIORITY_MAP[i]);
+        message += fmt::format("    {:<22} {:>8}\n", "Bursts with deadlines:", stats.deadline_jobs[i]);
+        message += fmt::format("    {:<22} {:>8}\n", "Deadline misses:", stats.deadline_misses[i]);
+        message += fmt::format("    {:<22} {:>8.{}f}\n\n", "Avg. tardiness:", avg_tardiness, 2);
+
+        *this->out << message;
+    }
+
+    std::string lateness_message = "BURST LATENESS:\n";
+    lateness_message += fmt::format("    {:<22} {:>8}\n", "50th percentile:", stats.lateness_percentiles[0]);
+    lateness_message += fmt::format("    {:<22} {:>8}\n", "90th percentile:", stats.lateness_percentiles[1]);
+    lateness_message += fmt::format("    {:<22} {:>8}\n", "99th percentile:", stats.lateness_percentiles[2]);
+    lateness_message += fmt::format("    {:<22} {:>8}\n", "Maximum:", stats.lateness_percentiles[3]);
+
+    *this->out << lateness_message << std::endl;
+}
+
+void Logger::print_core_metrics(SystemStats stats) const {
+    /*
+    This prints something like this:
+
+    CPU CORES:
+        CPU 0:    SERVICE: 412    DISPATCH: 96     IDLE: 22     UTILIZATION: 95.85%
+        CPU 1:    SERVICE: 377    DISPATCH: 104    IDLE: 49     UTILIZATION: 90.76%
+    */
+
+    if (!this->metrics || this->cpus <= 1) {
+        return;
+    }
+
+    std::string message = "CPU CORES:\n";
+
+    for (size_t i = 0; i < stats.core_utilization.size(); i++) {
+        size_t busy_time = stats.core_service_times[i] + stats.core_dispatch_times[i];
+
+        message += fmt::format("    CPU {:<3}   ", fmt::format("{}:", i));
+        message += fmt::format("SERVICE: {:<6} ", stats.core_service_times[i]);
+        message += fmt::format("DISPATCH: {:<6} ", stats.core_dispatch_times[i]);
+        message += fmt::format("IDLE: {:<6} ", stats.total_time - busy_time);
+        message += fmt::format("UTILIZATION: {:.2f}%\n", stats.core_utilization[i]);
+    }
+
+    *this->out << message << std::endl;
+}
+
+void Logger::print_balance_metrics(SystemStats stats, std::string policy) const {
+    /*
+    This prints something like this:
+
+    LOAD BALANCING (steal):
+        Migrations:                   31
+        Migration time:               62
+        Steal attempts:               18
+        Successful steals:            11
+        Push migrations:               0
+        Avg. imbalance:             1.42
+        Max. imbalance:                4
+
+    IMBALANCE OVER TIME:
+        [0, 52):                    0.67
+        [52, 104):                  2.00
+        ...
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    std::string message = fmt::format("LOAD BALANCING ({}):\n", policy);
+    message += fmt::format("    {:<22} {:>8}\n", "Migrations:", stats.migrations);
+    message += fmt::format("    {:<22} {:>8}\n", "Migration time:", stats.migration_time);
+    message += fmt::format("    {:<22} {:>8}\n", "Steal attempts:", stats.steal_attempts);
+    message += fmt::format("    {:<22} {:>8}\n", "Successful steals:", stats.steals);
+    message += fmt::format("    {:<22} {:>8}\n", "Push migrations:", stats.push_migrations);
+    message += fmt::format("    {:<22} {:>8.{}f}\n", "Avg. imbalance:", stats.avg_imbalance, 2);
+    message += fmt::format("    {:<22} {:>8}\n\n", "Max. imbalance:", stats.max_imbalance);
+
+    message += "IMBALANCE OVER TIME:\n";
+    size_t windows = stats.imbalance_over_time.size();
+    for (size_t i = 0; i < windows; i++) {
+        std::string range = fmt::format("[{}, {}):", stats.total_time * i / windows, stats.total_time * (i + 1) / windows);
+        if (stats.imbalance_over_time[i] < 0) {
+            message += fmt::format("    {:<22} {:>8}\n", range, "-");
+        } else {
+            message += fmt::format("    {:<22} {:>8.{}f}\n", range, stats.imbalance_over_time[i], 2);
+        }
+    }
+
+    *this->out << message << std::endl;
+}
+
+void Logger::print_numa_metrics(SystemStats stats, const Topology& topology) const {
+    /*
+    This prints something like this:
+
+    NUMA (2 nodes x 4 CPUs):
+        Cross-node migrations:              12
+        Cross-node migration time:         240
+        Remote dispatches:                  35
+        Remote dispatch time:              175
+        Extra NUMA overhead:               415
+        Node 0:    CPUs 0-3     SERVICE: 812    DISPATCH: 203    REMOTE: 20     UTILIZATION: 91.20%
+        Node 1:    CPUs 4-7     SERVICE: 790    DISPATCH: 188    REMOTE: 15     UTILIZATION: 88.75%
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    std::string message = fmt::format("NUMA ({} nodes x {} CPUs):\n", topology.nodes, topology.cores_per_node);
+    message += fmt::format("    {:<30} {:>6}\n", "Cross-node migrations:", stats.cross_node_migrations);
+    message += fmt::format("    {:<30} {:>6}\n", "Cross-node migration time:", stats.cross_node_migration_time);
+    message += fmt::format("    {:<30} {:>6}\n", "Remote dispatches:", stats.remote_dispatches);
+    message += fmt::format("    {:<30} {:>6}\n", "Remote dispatch time:", stats.remote_dispatch_time);
+    message += fmt::format("    {:<30} {:>6}\n", "Extra NUMA overhead:", stats.cross_node_migration_time + stats.remote_dispatch_time);
+
+    for (int node = 0; node < topology.nodes; node++) {
+        int first = node * topology.cores_per_node;
+        int last = first + topology.cores_per_node - 1;
+
+        size_t service_time = 0, dispatch_time = 0;
+        double utilization = 0.0;
+        for (int cpu = first; cpu <= last; cpu++) {
+            service_time += stats.core_service_times[cpu];
+            dispatch_time += stats.core_dispatch_times[cpu];
+            utilization += stats.core_utilization[cpu] / topology.cores_per_node;
+        }
+
+        message += fmt::format("    Node {:<5} ", fmt::format("{}:", node));
+        message += fmt::format("CPUs {:<8}", fmt::format("{}-{}", first, last));
+        message += fmt::format("SERVICE: {:<6} ", service_time);
+        message += fmt::format("DISPATCH: {:<6} ", dispatch_time);
+        message += fmt::format("REMOTE: {:<6} ", stats.node_remote_dispatches[node]);
+        message += fmt::format("UTILIZATION: {:.2f}%\n", utilization);
+    }
+
+    *this->out << message << std::endl;
+}
+
+/*
+    format_priority_shift(stats, reference):
+        Formats a table of each priority's average response and turnaround times next to
+        those in the reference stats, and the difference.
+*/
+static std::string format_priority_shift(const SystemStats& stats, const SystemStats& reference) {
+    std::string message = fmt::format("    {:<12} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11}\n",
+        "", "Response", "Reference", "Shift", "Turnaround", "Reference", "Shift");
+
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        double response = stats.avg_thread_response_times[i];
+        double reference_response = reference.avg_thread_response_times[i];
+        double turnaround = stats.avg_thread_turnaround_times[i];
+        double reference_turnaround = reference.avg_thread_turnaround_times[i];
+
+        message += fmt::format("    {:<12} {:>11.2f} {:>11.2f} {:>+11.2f} {:>11.2f} {:>11.2f} {:>+11.2f}\n",
+            PROCESS_PRIORITY_MAP[i], response, reference_response, response - reference_response,
+            turnaround, reference_turnaround, turnaround - reference_turnaround);
+    }
+    return message;
+}
+
+void Logger::print_class_metrics(SystemStats stats, const std::vector<CoreClass>& classes, SystemStats reference) const {
+    /*
+    This prints something like this:
+
+    CORE CLASSES:
+        big:         CPUs 0-1     SPEED: 1.00    SERVICE: 412    DISPATCH: 96     BUSY: 508    UTILIZATION: 95.85%
+        little:      CPUs 2-5     SPEED: 0.50    SERVICE: 655    DISPATCH: 180    BUSY: 835    UTILIZATION: 78.77%
+
+    PRIORITY SHIFT (vs. every CPU at speed 1.00):
+                         Response   Reference       Shift  Turnaround   Reference       Shift
+        SYSTEM              23.33       12.00      +11.33       94.67       97.87       -3.20
+        ...
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    std::string message = "CORE CLASSES:\n";
+    int first = 0;
+    for (size_t i = 0; i < classes.size(); i++) {
+        int last = first + classes[i].count - 1;
+
+        message += fmt::format("    {:<12} ", classes[i].name + ":");
+        message += fmt::format("CPUs {:<8}", fmt::format("{}-{}", first, last));
+        message += fmt::format("SPEED: {:<7.2f} ", classes[i].speed);
+        message += fmt::format("SERVICE: {:<6} ", stats.class_service_times[i]);
+        message += fmt::format("DISPATCH: {:<6} ", stats.class_dispatch_times[i]);
+        message += fmt::format("BUSY: {:<6} ", stats.class_service_times[i] + stats.class_dispatch_times[i]);
+        message += fmt::format("UTILIZATION: {:.2f}%\n", stats.class_utilization[i]);
+        first = last + 1;
+    }
+
+    message += "\nPRIORITY SHIFT (vs. every CPU at speed 1.00):\n";
+    message += format_priority_shift(stats, reference);
+
+    *this->out << message << std::endl;
+}
+
+void Logger::print_smt_metrics(SystemStats stats, double slowdown, SystemStats reference) const {
+    /*
+    This prints something like this:
+
+    SMT (slowdown 1.30):
+        Contended time:               812
+                                   SMT on     SMT off      Change
+        Elapsed time:                 954        1130     -15.58%
+        Work per tick:               1.37        1.16     +18.45%
+        Threads per 1000 ticks:     10.48        8.85     +18.45%
+
+    PRIORITY SHIFT (vs. SMT off):
+        ...
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    auto change = [](double value, double reference) {
+        return (reference > 0.0) ? 100.0 * (value - reference) / reference : 0.0;
+    };
+
+    int threads = 0;
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        threads += stats.thread_counts[i];
+    }
+    double elapsed = std::max<size_t>(1, stats.total_time);
+    double reference_elapsed = std::max<size_t>(1, reference.total_time);
+
+    std::string message = fmt::format("SMT (slowdown {:.2f}):\n", slowdown);
+    message += fmt::format("    {:<24} {:>8}\n", "Contended time:", stats.smt_contended_time);
+    message += fmt::format("    {:<24} {:>8} {:>11} {:>11}\n", "", "SMT on", "SMT off", "Change");
+    message += fmt::format("    {:<24} {:>8} {:>11} {:>+10.2f}%\n", "Elapsed time:",
+        stats.total_time, reference.total_time, change(elapsed, reference_elapsed));
+    message += fmt::format("    {:<24} {:>8.2f} {:>11.2f} {:>+10.2f}%\n", "Work per tick:",
+        stats.cpu_work / elapsed, reference.cpu_work / reference_elapsed,
+        change(stats.cpu_work / elapsed, reference.cpu_work / reference_elapsed));
+    message += fmt::format("    {:<24} {:>8.2f} {:>11.2f} {:>+10.2f}%\n", "Threads per 1000 ticks:",
+        1000.0 * threads / elapsed, 1000.0 * threads / reference_elapsed,
+        change(1000.0 * threads / elapsed, 1000.0 * threads / reference_elapsed));
+
+    message += "\nPRIORITY SHIFT (vs. SMT off):\n";
+    message += format_priority_shift(stats, reference);
+
+    *this->out << message << std::endl;
+}
+
+void Logger::print_cache_metrics(SystemStats stats) const {
+    /*
+    This prints something like this:
+
+    CACHE WARMTH:
+        Warm dispatches:              57
+        Cold dispatches:              12
+        Evictions:                     8
+        Refill time:                 214
+        Avg. refill time:           3.10
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    size_t dispatches = stats.cache_warm_hits + stats.cache_cold_misses;
+
+    std::string message = "CACHE WARMTH:\n";
+    message += fmt::format("    {:<22} {:>8}\n", "Warm dispatches:", stats.cache_warm_hits);
+    message += fmt::format("    {:<22} {:>8}\n", "Cold dispatches:", stats.cache_cold_misses);
+    message += fmt::format("    {:<22} {:>8}\n", "Evictions:", stats.cache_evictions);
+    message += fmt::format("    {:<22} {:>8}\n", "Refill time:", stats.cache_refill_time);
+    message += fmt::format("    {:<22} {:>8.{}f}\n", "Avg. refill time:", dispatches > 0 ? (double) stats.cache_refill_time / dispatches : 0.0, 2);
+
+    *this->out << message << std::endl;
+}
+
+void Logger::print_pdes_metrics(int workers, size_t windows, const std::vector<size_t>& partition_events, double seconds, double sequential_seconds, bool same) const {
+    /*
+    This prints something like this:
+
+    PARALLEL ENGINE (4 logical processes, 4 workers):
+        Windows:                     96
+        Events:                    1480
+        Busiest process:         27.43%
+        Parallel time:          0.0031s
+        Sequential time:        0.0054s
+        Speedup:                   1.74
+        Results:              identical
+    */
+
+    if (!this->metrics) {
+        return;
+    }
+
+    size_t events = 0, busiest = 0;
+    for (size_t count : partition_events) {
+        events += count;
+        busiest = std::max(busiest, count);
+    }
+
+    std::string message = fmt::format("PARALLEL ENGINE ({} logical processes, {} workers):\n", partition_events.size(), workers);
+    message += fmt::format("    {:<22} {:>8}\n", "Windows:", windows);
+    message += fmt::format("    {:<22} {:>8}\n", "Events:", events);
+    message += fmt::format("    {:<22} {:>7.2f}%\n", "Busiest process:", events > 0 ? 100.0 * busiest / events : 0.0);
+    message += fmt::format("    {:<22} {:>7.4f}s\n", "Parallel time:", seconds);
+
+    // The sequential engine only ran if asked to (--pdes-verify).
+    if (sequential_seconds >= 0.0) {
+        message += fmt::format("    {:<22} {:>7.4f}s\n", "Sequential time:", sequential_seconds);
+        message += fmt::format("    {:<22} {:>8.2f}\n", "Speedup:", seconds > 0.0 ? sequential_seconds / seconds : 0.0);
+        message += fmt::format("    {:<22} {:>8}\n", "Results:", same ? "identical" : "DIFFERENT");
+    }
+
+    *this->out << message << std::endl;
 }
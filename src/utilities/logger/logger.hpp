@@ -1,12 +1,16 @@
 #ifndef LOGGER_HPP
 #define LOGGER_HPP
 
+#include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
+#include "types/core_class/core_class.hpp"
 #include "types/event/event.hpp"
 #include "types/process/process.hpp"
 #include "types/thread/thread.hpp"
 #include "types/system_stats/system_stats.hpp"
+#include "types/topology/topology.hpp"
 
 /*
     Logger:
@@ -45,6 +49,22 @@ public:
     */
     bool metrics;
 
+    /*
+        cpus:
+            The number of simulated CPUs. With more than one, verbose messages say which
+            CPU an event happened on, and per-CPU metrics are printed.
+
+            Set with the --cpus flag in the command line.
+    */
+    int cpus = 1;
+
+    /*
+        out:
+            Where the output goes. Standard output unless several simulations run at the
+            same time, each with its own buffer.
+    */
+    std::ostream* out = &std::cout;
+
     //==================================================
     //  Member functions
     //==================================================
@@ -56,10 +76,10 @@ public:
     Logger() {}
 
     /*
-        Logger(verbose, per_thread, metrics):
+        Logger(verbose, per_thread, metrics, cpus, out):
             Constructs a new logger object with the input parameters.
     */
-    Logger(bool verbose, bool per_thread, bool metrics) : verbose(verbose), per_thread(per_thread), metrics(metrics) {}
+    Logger(bool verbose, bool per_thread, bool metrics, int cpus = 1, std::ostream* out = &std::cout) : verbose(verbose), per_thread(per_thread), metrics(metrics), cpus(cpus), out(out) {}
 
     /*
         print_state_transition(event, before_state, after_state):
@@ -76,6 +96,13 @@ public:
     */
     void print_verbose(const std::shared_ptr<Event> event, std::shared_ptr<Thread> thread, std::string message) const;
 
+    /*
+        print_scheduling_decision(event, decision):
+            If 'verbose' is set to true, outputs the explanation of the scheduling decision
+            made for the given event. The explanation is only formatted if it is printed.
+    */
+    void print_scheduling_decision(const std::shared_ptr<Event> event, const SchedulingDecision& decision) const;
+
     /*
         print_per_thread_metrics(process):
             If per_thread is set to true, outputs detailed information
@@ -89,6 +116,102 @@ public:
             contained in a SystemStats object.
     */
     void print_simulation_metrics(SystemStats stats) const;
+
+    /*
+        print_scheduler_metrics(summary):
+            If metrics is set to true, outputs the algorithm-specific metrics returned by
+            Scheduler::metrics_summary(), unless there are none.
+    */
+    void print_scheduler_metrics(std::string summary) const;
+
+    /*
+        print_wait_metrics(stats):
+            If metrics is set to true, outputs the longest ready queue wait for each
+            thread priority. Useful for tuning priority aging.
+    */
+    void print_wait_metrics(SystemStats stats) const;
+
+    /*
+        print_prediction_metrics(process):
+            If metrics is set to true, outputs how well the CPU burst lengths of each of
+            the process's threads were predicted.
+    */
+    void print_prediction_metrics(std::shared_ptr<Process> process) const;
+
+    /*
+        print_prediction_summary(stats):
+            If metrics is set to true, outputs how well CPU burst lengths were predicted
+            for each thread priority.
+    */
+    void print_prediction_summary(SystemStats stats) const;
+
+    /*
+        print_affinity_metrics(stats):
+            If metrics is set to true, outputs how many dispatches affinity changed and
+            how much dispatch time that saved.
+    */
+    void print_affinity_metrics(SystemStats stats) const;
+
+    /*
+        print_deadline_metrics(stats):
+            If metrics is set to true, outputs deadline misses and tardiness for each
+            thread priority, and percentiles of the CPU burst lateness.
+    */
+    void print_deadline_metrics(SystemStats stats) const;
+
+    /*
+        print_core_metrics(stats):
+            If metrics is set to true and there is more than one CPU, outputs the service,
+            dispatch and idle time and the utilization of each CPU.
+    */
+    void print_core_metrics(SystemStats stats) const;
+
+    /*
+        print_balance_metrics(stats, policy):
+            If metrics is set to true, outputs the migrations and steals between the per-CPU
+            ready queues under the given load balancing policy, and the imbalance over time.
+    */
+    void print_balance_metrics(SystemStats stats, std::string policy) const;
+
+    /*
+        print_numa_metrics(stats, topology):
+            If metrics is set to true, outputs the extra dispatch overhead of migrating
+            threads between NUMA nodes and of running them away from their home node, and
+            the time spent on each node.
+    */
+    void print_numa_metrics(SystemStats stats, const Topology& topology) const;
+
+    /*
+        print_class_metrics(stats, classes, reference):
+            If metrics is set to true, outputs the busy time of each core class, and how the
+            response and turnaround times of each priority compare to the reference stats, from
+            the same simulation with every CPU at the reference speed.
+    */
+    void print_class_metrics(SystemStats stats, const std::vector<CoreClass>& classes, SystemStats reference) const;
+
+    /*
+        print_smt_metrics(stats, slowdown, reference):
+            If metrics is set to true, outputs how long hardware threads ran alongside their
+            sibling, and compares the throughput and the response and turnaround times of
+            each priority to the reference stats, from the same simulation without SMT.
+    */
+    void print_smt_metrics(SystemStats stats, double slowdown, SystemStats reference) const;
+
+    /*
+        print_cache_metrics(stats):
+            If metrics is set to true, outputs how often dispatches found the CPU's cache warm,
+            and the refill time the cache model added.
+    */
+    void print_cache_metrics(SystemStats stats) const;
+
+    /*
+        print_pdes_metrics(workers, windows, partition_events, seconds, sequential_seconds, same):
+            If metrics is set to true, outputs how the parallel engine split the simulation and
+            how long it took. If the sequential engine ran too (sequential_seconds is not
+            negative), also outputs the speedup and whether the results of the two were the
+            same.
+    */
+    void print_pdes_metrics(int workers, size_t windows, const std::vector<size_t>& partition_events, double seconds, double sequential_seconds, bool same) const;
 };
 
 #endif
@@ -0,0 +1,160 @@
+#ifndef CHASE_LEV_DEQUE_HPP
+#define CHASE_LEV_DEQUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*
+    ChaseLevDeque:
+        The work-stealing deque of Chase and Lev ("Dynamic Circular Work-Stealing Deque",
+        SPAA 2005), with the memory orderings of Le, Pop, Cohen and Zappa Nardelli
+        ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+
+        One thread, the owner, pushes and pops items at the bottom. Any other thread may
+        steal items from the top. Neither takes a lock, and the owner only has to
+        synchronize with thieves when they race for the last item.
+
+        T is stored in std::atomic, so it should be small and trivially copyable, like a
+        pointer. The deque grows when it is full. Arrays it has outgrown are kept until it is
+        destroyed, because a thief may still be reading from one.
+*/
+
+template <typename T>
+class ChaseLevDeque {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        ChaseLevDeque(capacity):
+            Creates an empty deque. The capacity must be a power of two.
+    */
+    ChaseLevDeque(long capacity = 64) {
+        arrays.push_back(std::make_unique<Array>(capacity));
+        array.store(arrays.back().get(), std::memory_order_relaxed);
+    }
+
+    ChaseLevDeque(const ChaseLevDeque&) = delete;
+    ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+    /*
+        push(item):
+            Adds an item at the bottom. Only the owner may call it.
+    */
+    void push(T item) {
+        long b = bottom.load(std::memory_order_relaxed);
+        long t = top.load(std::memory_order_acquire);
+        Array* a = array.load(std::memory_order_relaxed);
+
+        if (b - t > a->capacity - 1) {
+            a = grow(a, t, b);
+        }
+        a->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /*
+        pop(item):
+            Takes the item at the bottom, the one pushed last. Returns false if the deque was
+            empty or a thief took the last item first. Only the owner may call it.
+    */
+    bool pop(T& item) {
+        long b = bottom.load(std::memory_order_relaxed) - 1;
+        Array* a = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item = a->get(b);
+        if (t == b) {
+            // The last item: whoever moves top past it first has it.
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /*
+        steal(item):
+            Takes the item at the top, the oldest one. Returns false if the deque was empty or
+            another thread took the item first. Any thread may call it.
+    */
+    bool steal(T& item) {
+        long t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long b = bottom.load(std::memory_order_acquire);
+
+        if (t >= b) {
+            return false;
+        }
+
+        Array* a = array.load(std::memory_order_acquire);
+        item = a->get(t);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /*
+        size():
+            How many items the deque holds. Only a hint while other threads use it.
+    */
+    long size() const {
+        long b = bottom.load(std::memory_order_relaxed);
+        long t = top.load(std::memory_order_relaxed);
+        return (b > t) ? b - t : 0;
+    }
+
+private:
+
+    /*
+        Array:
+            A circular array of items, indexed by the ever growing top and bottom.
+    */
+    struct Array {
+        long capacity;
+        std::unique_ptr<std::atomic<T>[]> items;
+
+        Array(long capacity): capacity(capacity), items(new std::atomic<T>[capacity]) {}
+
+        T get(long index) const { return items[index & (capacity - 1)].load(std::memory_order_relaxed); }
+        void put(long index, T item) { items[index & (capacity - 1)].store(item, std::memory_order_relaxed); }
+    };
+
+    /*
+        grow(a, t, b):
+            Copies the items between top and bottom to an array twice the size, and makes it
+            the deque's array.
+    */
+    Array* grow(Array* a, long t, long b) {
+        arrays.push_back(std::make_unique<Array>(a->capacity * 2));
+        Array* bigger = arrays.back().get();
+        for (long i = t; i < b; i++) {
+            bigger->put(i, a->get(i));
+        }
+        array.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+    // Thieves write top and the owner writes bottom, so they are kept on separate cache lines.
+    alignas(64) std::atomic<long> top{0};
+    alignas(64) std::atomic<long> bottom{0};
+    std::atomic<Array*> array;
+
+    /*
+        arrays:
+            Every array the deque has used, so that none is freed while a thief may read it.
+            Only the owner changes it.
+    */
+    std::vector<std::unique_ptr<Array>> arrays;
+};
+
+#endif
@@ -0,0 +1,114 @@
+#include "utilities/task_runtime/chase_lev_deque.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(ChaseLevDeque, OwnerPopsNewestFirst) {
+    ChaseLevDeque<long> deque(4);
+    for (long i = 0; i < 100; i++) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.size(), 100);
+
+    long item = -1;
+    for (long i = 99; i >= 0; i--) {
+        ASSERT_TRUE(deque.pop(item));
+        EXPECT_EQ(item, i);
+    }
+    EXPECT_FALSE(deque.pop(item));
+    EXPECT_EQ(deque.size(), 0);
+}
+
+TEST(ChaseLevDeque, ThiefStealsOldestFirst) {
+    ChaseLevDeque<long> deque(4);
+    for (long i = 0; i < 10; i++) {
+        deque.push(i);
+    }
+
+    long item = -1;
+    ASSERT_TRUE(deque.steal(item));
+    EXPECT_EQ(item, 0);
+    ASSERT_TRUE(deque.pop(item));
+    EXPECT_EQ(item, 9);
+    ASSERT_TRUE(deque.steal(item));
+    EXPECT_EQ(item, 1);
+    EXPECT_EQ(deque.size(), 7);
+}
+
+TEST(ChaseLevDeque, StealAndPopRaceForLastItem) {
+    // Exactly one of the owner and the thief gets the only item, every time.
+    for (int round = 0; round < 2000; round++) {
+        ChaseLevDeque<long> deque(2);
+        deque.push(round);
+
+        std::atomic<bool> go{false};
+        long stolen = -1;
+        bool thief_won = false;
+        std::thread thief([&] {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            thief_won = deque.steal(stolen);
+        });
+
+        go = true;
+        long popped = -1;
+        bool owner_won = deque.pop(popped);
+        thief.join();
+
+        ASSERT_NE(owner_won, thief_won) << "round " << round;
+        EXPECT_EQ(owner_won ? popped : stolen, round);
+        EXPECT_EQ(deque.size(), 0);
+        EXPECT_FALSE(deque.pop(popped));
+    }
+}
+
+TEST(ChaseLevDeque, GrowsWhileThievesSteal) {
+    // The deque starts small, so the owner grows it many times while the thieves read from
+    // the arrays it grows out of. Every item must be taken exactly once.
+    const long count = 200000;
+    const int thieves = 3;
+    ChaseLevDeque<long> deque(2);
+    std::vector<std::atomic<int>> taken(count);
+    for (auto& times : taken) {
+        times = 0;
+    }
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thieves; i++) {
+        threads.emplace_back([&] {
+            long item;
+            while (!done.load() || deque.size() > 0) {
+                if (deque.steal(item)) {
+                    taken[item]++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    long item;
+    for (long i = 0; i < count; i++) {
+        deque.push(i);
+        // Now and then the owner takes some back, so both ends move.
+        if (i % 7 == 0 && deque.pop(item)) {
+            taken[item]++;
+        }
+    }
+    while (deque.pop(item)) {
+        taken[item]++;
+    }
+    done = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (long i = 0; i < count; i++) {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+}
@@ -0,0 +1,240 @@
+#include "utilities/task_runtime/task_runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*
+    current_runtime, current_index:
+        The runtime whose worker the calling thread is, and its index, or nullptr and -1.
+*/
+static thread_local const TaskRuntime* current_runtime = nullptr;
+static thread_local int current_index = -1;
+
+/*
+    SPINS:
+        How many times an idle worker looks for a task, yielding in between, before it sleeps.
+*/
+static const int SPINS = 64;
+
+//==================================================
+//  TaskGroup
+//==================================================
+
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    } catch (...) {
+    }
+}
+
+void TaskGroup::spawn(std::function<void()> function) {
+    pending++;
+    runtime.submit(new TaskRuntime::Task{std::move(function), this});
+}
+
+void TaskGroup::wait() {
+    // The runtime is only asked while tasks remain, so a group whose tasks have all run can
+    // still be waited on after the runtime is gone.
+    int worker = (pending.load(std::memory_order_acquire) > 0) ? runtime.current_worker() : -1;
+
+    // A worker helps with whatever tasks there are until the group's are all done. Any other
+    // thread just sleeps, so that only the workers run tasks.
+    while (worker >= 0 && pending.load(std::memory_order_acquire) > 0) {
+        TaskRuntime::Task* task = runtime.find_task(worker);
+        if (task != nullptr) {
+            runtime.execute(task);
+        } else {
+            // The group's last tasks are running elsewhere. Check again now and then in
+            // case they fork more.
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait_for(lock, std::chrono::milliseconds(1), [this] { return pending.load() == 0; });
+        }
+    }
+
+    // Taking the mutex also waits for the last task to let go of it, so the group can go
+    // away once this returns.
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return pending.load() == 0; });
+    if (error != nullptr) {
+        std::exception_ptr first = error;
+        error = nullptr;
+        std::rethrow_exception(first);
+    }
+}
+
+//==================================================
+//  TaskRuntime
+//==================================================
+
+TaskRuntime::TaskRuntime(int workers, bool pin) {
+    if (workers <= 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Every deque exists before any worker starts stealing from them.
+    for (int i = 0; i < workers; i++) {
+        this->workers.push_back(std::make_unique<Worker>());
+        this->workers.back()->random = 2654435761u * (i + 1);
+    }
+    for (int i = 0; i < workers; i++) {
+        this->workers[i]->thread = std::thread(&TaskRuntime::work, this, i, pin);
+    }
+}
+
+TaskRuntime::~TaskRuntime() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (const auto& worker : workers) {
+        worker->thread.join();
+    }
+}
+
+int TaskRuntime::current_worker() const {
+    return (current_runtime == this) ? current_index : -1;
+}
+
+void TaskRuntime::submit(Task* task) {
+    queued++;
+
+    int worker = current_worker();
+    if (worker >= 0) {
+        workers[worker]->deque.push(task);
+    } else {
+        std::lock_guard<std::mutex> lock(injected_mutex);
+        injected.push_back(task);
+    }
+
+    if (sleepers.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        wake.notify_one();
+    }
+}
+
+TaskRuntime::Task* TaskRuntime::find_task(int worker) {
+    Task* task = nullptr;
+
+    if (workers[worker]->deque.pop(task)) {
+        queued--;
+        return task;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(injected_mutex);
+        if (!injected.empty()) {
+            task = injected.front();
+            injected.pop_front();
+            queued--;
+            return task;
+        }
+    }
+
+    unsigned int& random = workers[worker]->random;
+    random = random * 1664525u + 1013904223u;
+    size_t count = workers.size();
+    size_t start = (random >> 8) % count;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t victim = (start + i) % count;
+        if ((int) victim != worker && workers[victim]->deque.steal(task)) {
+            queued--;
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void TaskRuntime::execute(Task* task) {
+    TaskGroup* group = task->group;
+
+    try {
+        task->function();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(group->mutex);
+        if (group->error == nullptr) {
+            group->error = std::current_exception();
+        }
+    }
+    delete task;
+
+    // Finishing under the mutex means the group outlives this, even if its waiter returns.
+    std::lock_guard<std::mutex> lock(group->mutex);
+    if (--group->pending == 0) {
+        group->finished.notify_all();
+    }
+}
+
+void TaskRuntime::work(int index, bool pin) {
+    current_runtime = this;
+    current_index = index;
+
+#ifdef __linux__
+    if (pin) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(index % std::max(1u, std::thread::hardware_concurrency()), &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#endif
+
+    while (true) {
+        Task* task = nullptr;
+        for (int spin = 0; spin < SPINS && task == nullptr; spin++) {
+            task = find_task(index);
+            if (task == nullptr) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (task != nullptr) {
+            execute(task);
+            continue;
+        }
+
+        // Once the runtime is stopping, a worker leaves when nothing is left to run. Forking
+        // a task counts it as queued before it wakes a sleeper, so none is missed.
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        if (stopping.load() && queued.load() == 0) {
+            return;
+        }
+        sleepers++;
+        wake.wait(lock, [this] { return queued.load() > 0 || stopping.load(); });
+        sleepers--;
+    }
+}
+
+void TaskRuntime::parallel_for(size_t count, const std::function<void(size_t)>& body, size_t grain) {
+    TaskGroup group(*this);
+    grain = std::max((size_t) 1, grain);
+
+    // Outside the runtime, even the first piece is left to the workers.
+    if (current_worker() >= 0) {
+        split(0, count, body, grain, group);
+    } else {
+        group.spawn([this, count, &body, grain, &group] {
+            split(0, count, body, grain, group);
+        });
+    }
+    group.wait();
+}
+
+void TaskRuntime::split(size_t begin, size_t end, const std::function<void(size_t)>& body, size_t grain, TaskGroup& group) {
+    while (end - begin > grain) {
+        size_t middle = begin + (end - begin) / 2;
+        group.spawn([this, middle, end, &body, grain, &group] {
+            split(middle, end, body, grain, group);
+        });
+        end = middle;
+    }
+    for (size_t i = begin; i < end; i++) {
+        body(i);
+    }
+}
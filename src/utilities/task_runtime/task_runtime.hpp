@@ -0,0 +1,224 @@
+#ifndef TASK_RUNTIME_HPP
+#define TASK_RUNTIME_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utilities/task_runtime/chase_lev_deque.hpp"
+
+class TaskRuntime;
+
+/*
+    TaskGroup:
+        A set of tasks forked on a TaskRuntime, which can be joined as one. Tasks may fork
+        more tasks into the group they run in.
+
+        A worker waiting on a group runs its tasks, or any others, instead of blocking, so
+        tasks may wait on groups of their own without tying up a worker. Threads outside the
+        runtime block until the group is done.
+*/
+
+class TaskGroup {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        TaskGroup(runtime):
+            Creates an empty group whose tasks run on the given runtime.
+    */
+    TaskGroup(TaskRuntime& runtime): runtime(runtime) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /*
+        ~TaskGroup():
+            Waits for the group's tasks, ignoring any exception they threw.
+    */
+    ~TaskGroup();
+
+    /*
+        spawn(function):
+            Forks a task that calls the function.
+    */
+    void spawn(std::function<void()> function);
+
+    /*
+        wait():
+            Joins the group: returns once every task forked into it has finished. If any of
+            them threw, rethrows the first exception.
+    */
+    void wait();
+
+private:
+    friend class TaskRuntime;
+
+    TaskRuntime& runtime;
+
+    /*
+        pending:
+            The number of the group's tasks that have not finished.
+    */
+    std::atomic<long> pending{0};
+
+    /*
+        mutex, finished, error:
+            Guard the end of the group, wake a thread waiting for it, and hold the first
+            exception thrown by one of its tasks.
+    */
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error = nullptr;
+};
+
+/*
+    TaskRuntime:
+        A pool of worker threads that run tasks by work stealing. Each worker has its own
+        ChaseLevDeque: tasks forked on a worker go to the bottom of its deque, and it takes
+        its newest task from there, while idle workers steal the oldest tasks from the
+        others. Tasks forked from outside the runtime go to a shared queue instead.
+
+        Workers that find nothing to do spin for a short while and then sleep until a task is
+        forked. Tasks still queued when the runtime is destroyed are run before it stops.
+*/
+
+class TaskRuntime {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        TaskRuntime(workers, pin):
+            Starts the given number of worker threads, or one per hardware thread if it is 0.
+            If pin is set, worker i only runs on CPU i (modulo the number of CPUs), where the
+            platform allows it.
+    */
+    TaskRuntime(int workers = 0, bool pin = false);
+
+    TaskRuntime(const TaskRuntime&) = delete;
+    TaskRuntime& operator=(const TaskRuntime&) = delete;
+
+    /*
+        ~TaskRuntime():
+            Runs the tasks that are still queued, including any they fork, then stops and
+            joins the workers.
+    */
+    ~TaskRuntime();
+
+    /*
+        size():
+            The number of worker threads.
+    */
+    int size() const { return workers.size(); }
+
+    /*
+        parallel_for(count, body, grain):
+            Calls body(i) for every i from 0 to count - 1, in parallel, and returns once all
+            the calls have. The range is split in halves, forked as tasks, until the pieces
+            are at most grain long. Rethrows the first exception a call threw.
+    */
+    void parallel_for(size_t count, const std::function<void(size_t)>& body, size_t grain = 1);
+
+    /*
+        current_worker():
+            The index of the worker of this runtime that the calling thread is, or -1 if it
+            is not one.
+    */
+    int current_worker() const;
+
+private:
+    friend class TaskGroup;
+
+    /*
+        Task:
+            A forked function, and the group it was forked into.
+    */
+    struct Task {
+        std::function<void()> function;
+        TaskGroup* group;
+    };
+
+    /*
+        Worker:
+            A worker thread and its deque. Only the worker pushes to and pops from the deque.
+    */
+    struct Worker {
+        ChaseLevDeque<Task*> deque;
+        std::thread thread;
+        unsigned int random = 0;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /*
+        injected, injected_mutex:
+            The tasks forked by threads that are not workers.
+    */
+    std::deque<Task*> injected;
+    std::mutex injected_mutex;
+
+    /*
+        queued:
+            The number of tasks that have been forked but not taken yet.
+    */
+    std::atomic<long> queued{0};
+
+    /*
+        sleepers, sleep_mutex, wake:
+            The number of workers sleeping until a task is forked, and what they sleep on.
+    */
+    std::atomic<int> sleepers{0};
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+
+    std::atomic<bool> stopping{false};
+
+    /*
+        submit(task):
+            Queues a forked task: on the calling worker's deque, or on the shared queue from
+            outside the runtime. Wakes a sleeping worker.
+    */
+    void submit(Task* task);
+
+    /*
+        find_task(worker):
+            Takes a task for the given worker to run: the newest from its own deque, the
+            oldest from the shared queue, or one stolen from another worker, starting from a
+            random one. Returns nullptr if there is none.
+    */
+    Task* find_task(int worker);
+
+    /*
+        execute(task):
+            Runs the task, records any exception in its group, and counts it as finished.
+    */
+    void execute(Task* task);
+
+    /*
+        work(index, pin):
+            The loop of worker index, pinned to its CPU if pin is set: runs tasks until the
+            runtime stops.
+    */
+    void work(int index, bool pin);
+
+    /*
+        split(begin, end, body, grain, group):
+            Runs body(i) for i in [begin, end), forking the upper halves into the group.
+    */
+    void split(size_t begin, size_t end, const std::function<void(size_t)>& body, size_t grain, TaskGroup& group);
+};
+
+#endif
@@ -0,0 +1,94 @@
+#include "utilities/task_runtime/task_runtime.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TaskRuntime, ParallelForCallsEveryIndexOnce) {
+    TaskRuntime runtime(4);
+    for (size_t grain : {1, 3, 1000}) {
+        std::vector<std::atomic<int>> calls(1000);
+        for (auto& times : calls) {
+            times = 0;
+        }
+
+        runtime.parallel_for(calls.size(), [&](size_t i) { calls[i]++; }, grain);
+
+        for (size_t i = 0; i < calls.size(); i++) {
+            ASSERT_EQ(calls[i].load(), 1) << "index " << i << ", grain " << grain;
+        }
+    }
+}
+
+TEST(TaskRuntime, NestedGroupsDoNotTieUpWorkers) {
+    // Every task waits on a group of its own, with fewer workers than waiting tasks.
+    TaskRuntime runtime(2);
+    std::atomic<int> leaves{0};
+
+    TaskGroup outer(runtime);
+    for (int i = 0; i < 8; i++) {
+        outer.spawn([&] {
+            TaskGroup inner(runtime);
+            for (int j = 0; j < 8; j++) {
+                inner.spawn([&] { leaves++; });
+            }
+            inner.wait();
+        });
+    }
+    outer.wait();
+    EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST(TaskRuntime, WaitRethrowsTheFirstException) {
+    TaskRuntime runtime(2);
+    std::atomic<int> ran{0};
+
+    TaskGroup group(runtime);
+    group.spawn([] { throw std::runtime_error("task failed"); });
+    for (int i = 0; i < 10; i++) {
+        group.spawn([&] { ran++; });
+    }
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(ran.load(), 10);
+
+    // The exception is only thrown once.
+    EXPECT_NO_THROW(group.wait());
+}
+
+TEST(TaskRuntime, ShutdownRunsQueuedTasks) {
+    // The first task keeps the only worker busy, so the others are still queued when the
+    // runtime is destroyed. The ones forked by a task go to the worker's own deque.
+    std::atomic<int> ran{0};
+    auto runtime = std::make_unique<TaskRuntime>(1);
+    TaskGroup group(*runtime);
+
+    group.spawn([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        for (int i = 0; i < 50; i++) {
+            group.spawn([&] { ran++; });
+        }
+        ran++;
+    });
+    for (int i = 0; i < 100; i++) {
+        group.spawn([&] { ran++; });
+    }
+
+    runtime.reset();
+    EXPECT_EQ(ran.load(), 151);
+    EXPECT_NO_THROW(group.wait());
+}
+
+TEST(TaskRuntime, ShutdownWithIdleWorkers) {
+    // Workers asleep, or still spinning after their last task, stop promptly.
+    for (int round = 0; round < 20; round++) {
+        TaskRuntime runtime(4);
+        std::atomic<int> ran{0};
+        runtime.parallel_for(16, [&](size_t) { ran++; });
+        EXPECT_EQ(ran.load(), 16);
+    }
+}
@@ -0,0 +1,157 @@
+#ifndef THREAD_HEAP_HPP
+#define THREAD_HEAP_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types/thread/thread.hpp"
+
+/*
+    ThreadHeap<Compare>:
+        An indexed binary min-heap of threads. Each thread stores its position in the heap
+        (Thread::heap_index), so a thread can be removed or re-positioned after its key
+        changes in O(log n) without searching for it.
+
+        Compare is a function object where Compare()(a, b) is true if thread a should run
+        before thread b. Threads that compare equal leave the heap in the order they were
+        pushed (first in, first out).
+
+        Like ThreadList, the heap holds plain pointers and does not own its threads.
+        A thread can be in at most one ThreadHeap at a time.
+*/
+
+template <typename Compare>
+class ThreadHeap {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        push(thread):
+            Adds a thread to the heap.
+    */
+    void push(const std::shared_ptr<Thread>& thread) {
+        thread->heap_index = entries.size();
+        entries.push_back(Entry{thread.get(), next_sequence++});
+        sift_up(entries.size() - 1);
+    }
+
+    /*
+        top():
+            Returns the thread that should run first. The heap must not be empty.
+    */
+    Thread* top() const { return entries.front().thread; }
+
+    /*
+        pop():
+            Removes and returns the thread that should run first. The heap must not be empty.
+    */
+    std::shared_ptr<Thread> pop() { return remove_at(0)->shared_from_this(); }
+
+    /*
+        remove(thread):
+            Removes the given thread from the heap. Returns false if it was not in the heap.
+    */
+    bool remove(const std::shared_ptr<Thread>& thread) {
+        if (!contains(thread)) {
+            return false;
+        }
+        remove_at(thread->heap_index);
+        return true;
+    }
+
+    /*
+        update(thread):
+            Restores the heap order after the thread's key (e.g., its deadline) has changed.
+    */
+    void update(const std::shared_ptr<Thread>& thread) {
+        if (contains(thread)) {
+            sift_down(sift_up(thread->heap_index));
+        }
+    }
+
+    /*
+        contains(thread):
+            Returns true if the thread is in this heap.
+    */
+    bool contains(const std::shared_ptr<Thread>& thread) const {
+        return thread->heap_index >= 0 && (size_t) thread->heap_index < entries.size() && entries[thread->heap_index].thread == thread.get();
+    }
+
+    size_t size() const { return entries.size(); }
+
+    bool empty() const { return entries.empty(); }
+
+private:
+
+    /*
+        Entry:
+            A thread along with the order it was pushed in, used to break ties.
+    */
+    struct Entry {
+        Thread* thread;
+        unsigned long sequence;
+    };
+
+    std::vector<Entry> entries;
+
+    unsigned long next_sequence = 0;
+
+    bool before(const Entry& a, const Entry& b) const {
+        if (Compare()(*a.thread, *b.thread)) return true;
+        if (Compare()(*b.thread, *a.thread)) return false;
+        return a.sequence < b.sequence;
+    }
+
+    void place(size_t index, Entry entry) {
+        entry.thread->heap_index = index;
+        entries[index] = std::move(entry);
+    }
+
+    size_t sift_up(size_t index) {
+        Entry entry = std::move(entries[index]);
+        while (index > 0) {
+            size_t parent = (index - 1) / 2;
+            if (!before(entry, entries[parent])) break;
+            place(index, std::move(entries[parent]));
+            index = parent;
+        }
+        place(index, std::move(entry));
+        return index;
+    }
+
+    size_t sift_down(size_t index) {
+        Entry entry = std::move(entries[index]);
+        size_t count = entries.size();
+        while (true) {
+            size_t child = 2 * index + 1;
+            if (child >= count) break;
+            if (child + 1 < count && before(entries[child + 1], entries[child])) child++;
+            if (!before(entries[child], entry)) break;
+            place(index, std::move(entries[child]));
+            index = child;
+        }
+        place(index, std::move(entry));
+        return index;
+    }
+
+    Thread* remove_at(size_t index) {
+        Thread* thread = entries[index].thread;
+        thread->heap_index = -1;
+
+        if (index != entries.size() - 1) {
+            place(index, std::move(entries.back()));
+            entries.pop_back();
+            sift_down(sift_up(index));
+        } else {
+            entries.pop_back();
+        }
+        return thread;
+    }
+};
+
+#endif
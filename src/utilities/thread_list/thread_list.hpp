@@ -0,0 +1,158 @@
+#ifndef THREAD_LIST_HPP
+#define THREAD_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#include "types/thread/thread.hpp"
+
+/*
+    ThreadList:
+        An intrusive first-in, first-out list of threads, used for the ready queues. The links
+        live in the threads themselves (Thread::ready_prev and Thread::ready_next), so adding
+        or removing a thread never allocates memory and does not copy a shared_ptr.
+
+        The list does not own its threads; the simulation keeps every thread alive for the
+        whole run. It mirrors the parts of the std::deque interface that the schedulers use,
+        so a thread anywhere in the list can be removed in O(1) through an iterator.
+
+        A thread can be in at most one ThreadList at a time.
+*/
+
+class ThreadList {
+public:
+
+    /*
+        iterator:
+            A forward iterator over the threads in the list, from front to back.
+    */
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Thread*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Thread* const*;
+        using reference = Thread* const&;
+
+        iterator(Thread* thread = nullptr): thread(thread) {}
+
+        reference operator*() const { return thread; }
+
+        iterator& operator++() {
+            thread = thread->ready_next;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const { return thread == other.thread; }
+
+        bool operator!=(const iterator& other) const { return thread != other.thread; }
+
+    private:
+        Thread* thread;
+    };
+
+    ThreadList() = default;
+
+    ThreadList(const ThreadList&) = delete;
+
+    ThreadList& operator=(const ThreadList&) = delete;
+
+    /*
+        ThreadList(other):
+            Takes over the threads of other, which is left empty. The threads' links do not
+            point at the list itself, so they stay valid.
+    */
+    ThreadList(ThreadList&& other) noexcept: head(other.head), tail(other.tail), count(other.count) {
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.count = 0;
+    }
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        push_back(thread):
+            Adds a thread to the back of the list.
+    */
+    void push_back(Thread* thread) {
+        thread->ready_prev = tail;
+        thread->ready_next = nullptr;
+        if (tail != nullptr) {
+            tail->ready_next = thread;
+        } else {
+            head = thread;
+        }
+        tail = thread;
+        count++;
+    }
+
+    void push_back(const std::shared_ptr<Thread>& thread) { push_back(thread.get()); }
+
+    /*
+        front():
+            Returns the thread at the front of the list. The list must not be empty.
+    */
+    Thread* const& front() const { return head; }
+
+    /*
+        pop_front():
+            Removes and returns the thread at the front of the list. The list must not be empty.
+    */
+    std::shared_ptr<Thread> pop_front() {
+        Thread* thread = head;
+        erase(begin());
+        return thread->shared_from_this();
+    }
+
+    /*
+        erase(position):
+            Removes the thread at the given position and returns an iterator to the one after it.
+    */
+    iterator erase(iterator position) {
+        Thread* thread = *position;
+        Thread* next = thread->ready_next;
+
+        if (thread->ready_prev != nullptr) {
+            thread->ready_prev->ready_next = next;
+        } else {
+            head = next;
+        }
+        if (next != nullptr) {
+            next->ready_prev = thread->ready_prev;
+        } else {
+            tail = thread->ready_prev;
+        }
+
+        thread->ready_prev = nullptr;
+        thread->ready_next = nullptr;
+        count--;
+        return iterator(next);
+    }
+
+    iterator begin() const { return iterator(head); }
+
+    iterator end() const { return iterator(); }
+
+    size_t size() const { return count; }
+
+    bool empty() const { return count == 0; }
+
+private:
+
+    Thread* head = nullptr;
+
+    Thread* tail = nullptr;
+
+    size_t count = 0;
+};
+
+#endif
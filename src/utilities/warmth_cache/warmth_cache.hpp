@@ -0,0 +1,167 @@
+#ifndef WARMTH_CACHE_HPP
+#define WARMTH_CACHE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/*
+    WarmthCache:
+        A model of how warm a CPU's caches are for each process. It keeps the footprints of
+        the processes that ran on the CPU most recently, up to a fixed capacity, in least
+        recently used order, with the time each one last ran.
+
+        A process whose footprint is still in the cache pays a refill cost that grows with
+        the time since it last ran, from 0 towards the full cold cost:
+
+            cold_cost * (1 - 2^(-age / half_life))
+
+        A process whose footprint is not in the cache, because it never ran on the CPU or was
+        evicted by others since, pays the whole cold cost.
+
+        The entries live in a vector linked into a list by index, so lookups, moves to the
+        front and evictions are all O(1). The vector is reserved when the cache is created
+        and never grows past its capacity, but the index from process to entry is a hash
+        map, which allocates a node each time a process is added to it.
+*/
+
+class WarmthCache {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        capacity, cold_cost, half_life:
+            How many process footprints the cache holds, the refill cost of a cold cache, and
+            how long a footprint takes to lose half its warmth.
+    */
+    size_t capacity;
+    int cold_cost;
+    int half_life;
+
+    /*
+        warm_hits, cold_misses, evictions:
+            How many times a process found its footprint in the cache or not, and how many
+            footprints were pushed out by others.
+    */
+    size_t warm_hits = 0;
+    size_t cold_misses = 0;
+    size_t evictions = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    WarmthCache(size_t capacity, int cold_cost, int half_life):
+        capacity(capacity), cold_cost(cold_cost), half_life(half_life) {
+        entries.reserve(capacity);
+        index_of.reserve(capacity);
+    }
+
+    /*
+        switch_cost(process_id, time):
+            Returns the refill cost of running the process at the given time, and makes it
+            the most recently used.
+    */
+    int switch_cost(int process_id, unsigned int time) {
+        auto found = index_of.find(process_id);
+        if (found == index_of.end()) {
+            cold_misses++;
+            insert(process_id, time);
+            return cold_cost;
+        }
+
+        warm_hits++;
+        int index = found->second;
+        unsigned int age = time - entries[index].last_ran;
+        move_to_front(index);
+        entries[index].last_ran = time;
+        return (int) std::lround(cold_cost * (1.0 - std::exp2(-(double) age / half_life)));
+    }
+
+    /*
+        touch(process_id, time):
+            Records that the process was still running at the given time, for example at
+            the end of a run.
+    */
+    void touch(int process_id, unsigned int time) {
+        auto found = index_of.find(process_id);
+        if (found == index_of.end()) {
+            insert(process_id, time);
+            return;
+        }
+        move_to_front(found->second);
+        entries[found->second].last_ran = time;
+    }
+
+private:
+
+    /*
+        Entry:
+            One process footprint, linked to the more (prev) and less (next) recently used
+            ones by their index in entries. -1 ends the list.
+    */
+    struct Entry {
+        int process_id;
+        unsigned int last_ran;
+        int prev = -1;
+        int next = -1;
+    };
+
+    std::vector<Entry> entries;
+    std::unordered_map<int, int> index_of;
+    int head = -1;
+    int tail = -1;
+
+    void unlink(int index) {
+        Entry& entry = entries[index];
+        (entry.prev != -1 ? entries[entry.prev].next : head) = entry.next;
+        (entry.next != -1 ? entries[entry.next].prev : tail) = entry.prev;
+        entry.prev = entry.next = -1;
+    }
+
+    void push_front(int index) {
+        entries[index].next = head;
+        if (head != -1) {
+            entries[head].prev = index;
+        }
+        head = index;
+        if (tail == -1) {
+            tail = index;
+        }
+    }
+
+    void move_to_front(int index) {
+        if (index != head) {
+            unlink(index);
+            push_front(index);
+        }
+    }
+
+    /*
+        insert(process_id, time):
+            Adds a footprint at the front, reusing the least recently used entry if the cache
+            is full.
+    */
+    void insert(int process_id, unsigned int time) {
+        int index;
+        if (entries.size() < capacity) {
+            index = entries.size();
+            entries.push_back(Entry{process_id, time});
+        } else {
+            index = tail;
+            unlink(index);
+            index_of.erase(entries[index].process_id);
+            evictions++;
+            entries[index].process_id = process_id;
+            entries[index].last_ran = time;
+        }
+        index_of[process_id] = index;
+        push_front(index);
+    }
+};
+
+#endif
@@ -0,0 +1,54 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      644.00
+    Avg. turnaround time:   3727.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      369.38
+    Avg. turnaround time:   2530.75
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      282.75
+    Avg. turnaround time:   2673.00
+
+Total elapsed time:           4116
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          2954
+Total idle time:                35
+
+CPU utilization:            99.15%
+CPU efficiency:             27.38%
+
+ADAPTIVE QUANTUM:
+    Quantum changes:             65
+    Minimum quantum:              3
+    Maximum quantum:            144
+    Time-weighted average:   128.43
+    At time 0:                    3
+    At time 338:                129
+    At time 559:                126
+    At time 825:                133
+    At time 1070:               129
+    At time 1262:               118
+    At time 1536:               127
+    At time 1777:               126
+    At time 1947:               117
+    At time 2181:               127
+    At time 2411:               125
+    At time 2629:               132
+    At time 2848:               128
+    At time 3116:               134
+    At time 3317:               130
+    At time 3585:               135
+    At time 3947:               139
+
@@ -0,0 +1,57 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       86.33
+    Avg. turnaround time:   1176.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      424.25
+    Avg. turnaround time:    889.75
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1678
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           969
+Total idle time:                81
+
+CPU utilization:            95.17%
+CPU efficiency:             37.43%
+
+SYSTEM DEADLINES:
+    Bursts with deadlines:        0
+    Deadline misses:              0
+    Avg. tardiness:            0.00
+
+INTERACTIVE DEADLINES:
+    Bursts with deadlines:       11
+    Deadline misses:             11
+    Avg. tardiness:          100.55
+
+NORMAL DEADLINES:
+    Bursts with deadlines:       13
+    Deadline misses:             13
+    Avg. tardiness:           92.54
+
+BATCH DEADLINES:
+    Bursts with deadlines:        0
+    Deadline misses:              0
+    Avg. tardiness:            0.00
+
+BURST LATENESS:
+    50th percentile:             76
+    90th percentile:            163
+    99th percentile:            189
+    Maximum:                    189
+
@@ -0,0 +1,57 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       66.33
+    Avg. turnaround time:   1034.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      358.75
+    Avg. turnaround time:    727.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1635
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           853
+Total idle time:               154
+
+CPU utilization:            90.58%
+CPU efficiency:             38.41%
+
+SYSTEM DEADLINES:
+    Bursts with deadlines:        0
+    Deadline misses:              0
+    Avg. tardiness:            0.00
+
+INTERACTIVE DEADLINES:
+    Bursts with deadlines:       11
+    Deadline misses:             10
+    Avg. tardiness:           66.55
+
+NORMAL DEADLINES:
+    Bursts with deadlines:       13
+    Deadline misses:             11
+    Avg. tardiness:           58.00
+
+BATCH DEADLINES:
+    Bursts with deadlines:        0
+    Deadline misses:              0
+    Avg. tardiness:            0.00
+
+BURST LATENESS:
+    50th percentile:             69
+    90th percentile:             92
+    99th percentile:            125
+    Maximum:                    125
+
@@ -0,0 +1,58 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       35.00
+    Avg. turnaround time:    323.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:       44.50
+    Avg. turnaround time:    164.25
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:            493
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           377
+Total idle time:               967
+
+CPU utilization:            50.96%
+CPU efficiency:             31.85%
+
+CPU CORES:
+    CPU 0:    SERVICE: 151    DISPATCH: 57     IDLE: 285    UTILIZATION: 42.19%
+    CPU 1:    SERVICE: 191    DISPATCH: 74     IDLE: 228    UTILIZATION: 53.75%
+    CPU 2:    SERVICE: 180    DISPATCH: 128    IDLE: 185    UTILIZATION: 62.47%
+    CPU 3:    SERVICE: 106    DISPATCH: 118    IDLE: 269    UTILIZATION: 45.44%
+
+LOAD BALANCING (steal):
+    Migrations:                   8
+    Migration time:              16
+    Steal attempts:              38
+    Successful steals:           10
+    Push migrations:              0
+    Avg. imbalance:            0.65
+    Max. imbalance:               1
+
+IMBALANCE OVER TIME:
+    [0, 49):                   0.00
+    [49, 98):                  1.00
+    [98, 147):                 0.67
+    [147, 197):                1.00
+    [197, 246):                1.00
+    [246, 295):                0.00
+    [295, 345):                0.67
+    [345, 394):                1.00
+    [394, 443):                0.67
+    [443, 493):                0.67
+
@@ -0,0 +1,39 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      570.00
+    Avg. turnaround time:   9136.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      355.12
+    Avg. turnaround time:   7838.75
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:       74.50
+    Avg. turnaround time:   7938.25
+
+Total elapsed time:          12011
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         10884
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:              9.38%
+
+GANG QUANTUM USAGE:
+    Process 203:    TURNS: 15     USED: 135    AVG: 9.00  
+    Process 297:    TURNS: 8      USED: 71     AVG: 8.88  
+    Process 341:    TURNS: 15     USED: 121    AVG: 8.07  
+    Process 395:    TURNS: 15     USED: 177    AVG: 11.80 
+    Process 404:    TURNS: 28     USED: 304    AVG: 10.86 
+    Process 613:    TURNS: 27     USED: 319    AVG: 11.81 
+
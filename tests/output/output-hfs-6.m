@@ -0,0 +1,39 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      468.00
+    Avg. turnaround time:  15151.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      266.25
+    Avg. turnaround time:   9755.75
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      578.25
+    Avg. turnaround time:  15581.25
+
+Total elapsed time:          17888
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         16579
+Total idle time:               182
+
+CPU utilization:            98.98%
+CPU efficiency:              6.30%
+
+FAIR SHARE GROUPS:
+    Group default:   SHARES: 1024   QUOTA: none       CPU: 135    THROTTLED: 0      (0 times)
+                     WAIT P50: 102    P90: 153    P99: 203    MAX: 203   
+    Group web:       SHARES: 2048   QUOTA: 20/100     CPU: 617    THROTTLED: 0      (0 times)
+                     WAIT P50: 328    P90: 532    P99: 633    MAX: 662   
+    Group batch:     SHARES: 512    QUOTA: 10/100     CPU: 375    THROTTLED: 289    (11 times)
+                     WAIT P50: 73     P90: 1333   P99: 1591   MAX: 1591  
+
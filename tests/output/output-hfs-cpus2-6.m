@@ -0,0 +1,43 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      272.00
+    Avg. turnaround time:   7482.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      167.38
+    Avg. turnaround time:   4853.38
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      188.25
+    Avg. turnaround time:   8087.75
+
+Total elapsed time:           9731
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         16336
+Total idle time:              1999
+
+CPU utilization:            89.73%
+CPU efficiency:              5.79%
+
+CPU CORES:
+    CPU 0:    SERVICE: 629    DISPATCH: 8489   IDLE: 613    UTILIZATION: 93.70%
+    CPU 1:    SERVICE: 498    DISPATCH: 7847   IDLE: 1386   UTILIZATION: 85.76%
+
+FAIR SHARE GROUPS:
+    Group default:   SHARES: 1024   QUOTA: none       CPU: 135    THROTTLED: 0      (0 times)
+                     WAIT P50: 35     P90: 60     P99: 99     MAX: 99    
+    Group web:       SHARES: 2048   QUOTA: 20/100     CPU: 617    THROTTLED: 0      (0 times)
+                     WAIT P50: 151    P90: 246    P99: 305    MAX: 306   
+    Group batch:     SHARES: 512    QUOTA: 10/100     CPU: 375    THROTTLED: 996    (21 times)
+                     WAIT P50: 49     P90: 605    P99: 682    MAX: 749   
+
@@ -0,0 +1,58 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      113.23
+    Avg. turnaround time:    924.46
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      684.50
+    Avg. turnaround time:   1786.20
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           2112
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          5841
+Total idle time:               473
+
+CPU utilization:            94.40%
+CPU efficiency:             25.26%
+
+CPU CORES:
+    CPU 0:    SERVICE: 506    DISPATCH: 1547   IDLE: 59     UTILIZATION: 97.21%
+    CPU 1:    SERVICE: 540    DISPATCH: 1505   IDLE: 67     UTILIZATION: 96.83%
+    CPU 2:    SERVICE: 610    DISPATCH: 1303   IDLE: 199    UTILIZATION: 90.58%
+    CPU 3:    SERVICE: 478    DISPATCH: 1486   IDLE: 148    UTILIZATION: 92.99%
+
+LOAD BALANCING (both):
+    Migrations:                  24
+    Migration time:              48
+    Steal attempts:              24
+    Successful steals:           11
+    Push migrations:             33
+    Avg. imbalance:            1.18
+    Max. imbalance:               3
+
+IMBALANCE OVER TIME:
+    [0, 211):                  1.09
+    [211, 422):                1.27
+    [422, 633):                1.40
+    [633, 844):                1.45
+    [844, 1056):               1.30
+    [1056, 1267):              1.55
+    [1267, 1478):              1.20
+    [1478, 1689):              0.91
+    [1689, 1900):              0.82
+    [1900, 2112):              0.82
+
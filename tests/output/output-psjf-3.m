@@ -0,0 +1,80 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      755.00
+    Avg. turnaround time:   3426.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      457.00
+    Avg. turnaround time:   2342.88
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      342.25
+    Avg. turnaround time:   3111.50
+
+Total elapsed time:           4207
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          3080
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:             26.79%
+
+Process 203 [NORMAL] burst predictions:
+    Thread  0:    BURSTS: 8      MAE: 10.04  RMSE: 11.96  BIAS: 2.47  
+
+Process 297 [BATCH] burst predictions:
+    Thread  0:    BURSTS: 3      MAE: 11.25  RMSE: 12.00  BIAS: 6.42  
+
+Process 341 [INTERACTIVE] burst predictions:
+    Thread  0:    BURSTS: 7      MAE: 13.48  RMSE: 14.50  BIAS: 2.40  
+
+Process 395 [NORMAL] burst predictions:
+    Thread  0:    BURSTS: 1      MAE: 8.00   RMSE: 8.00   BIAS: -8.00 
+    Thread  1:    BURSTS: 8      MAE: 9.65   RMSE: 12.43  BIAS: 2.36  
+    Thread  2:    BURSTS: 3      MAE: 11.67  RMSE: 13.13  BIAS: 5.67  
+
+Process 404 [BATCH] burst predictions:
+    Thread  0:    BURSTS: 10     MAE: 10.60  RMSE: 12.10  BIAS: 0.54  
+    Thread  1:    BURSTS: 6      MAE: 8.77   RMSE: 10.68  BIAS: 1.86  
+    Thread  2:    BURSTS: 3      MAE: 3.83   RMSE: 4.44   BIAS: -0.83 
+
+Process 613 [NORMAL] burst predictions:
+    Thread  0:    BURSTS: 6      MAE: 8.27   RMSE: 10.87  BIAS: -0.16 
+    Thread  1:    BURSTS: 7      MAE: 9.38   RMSE: 11.42  BIAS: 2.66  
+    Thread  2:    BURSTS: 1      MAE: 4.00   RMSE: 4.00   BIAS: 4.00  
+    Thread  3:    BURSTS: 6      MAE: 9.68   RMSE: 11.19  BIAS: 2.76  
+
+SYSTEM PREDICTIONS:
+    Predicted bursts:             0
+    Mean abs. error:           0.00
+    RMS error:                 0.00
+    Mean error (bias):         0.00
+
+INTERACTIVE PREDICTIONS:
+    Predicted bursts:             7
+    Mean abs. error:          13.48
+    RMS error:                14.50
+    Mean error (bias):         2.40
+
+NORMAL PREDICTIONS:
+    Predicted bursts:            40
+    Mean abs. error:           9.45
+    RMS error:                11.56
+    Mean error (bias):         2.15
+
+BATCH PREDICTIONS:
+    Predicted bursts:            22
+    Mean abs. error:           9.26
+    RMS error:                10.96
+    Mean error (bias):         1.51
+
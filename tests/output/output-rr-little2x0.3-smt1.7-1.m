@@ -0,0 +1,61 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       35.00
+    Avg. turnaround time:   2042.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:       37.25
+    Avg. turnaround time:   1341.75
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           2514
+Total service time:           1884
+Total I/O time:                517
+Total dispatch time:          5982
+Total idle time:              2190
+
+CPU utilization:            78.22%
+CPU efficiency:             18.74%
+
+CPU CORES:
+    CPU 0:    SERVICE: 636    DISPATCH: 1655   IDLE: 223    UTILIZATION: 91.13%
+    CPU 1:    SERVICE: 393    DISPATCH: 1400   IDLE: 721    UTILIZATION: 71.32%
+    CPU 2:    SERVICE: 429    DISPATCH: 1503   IDLE: 582    UTILIZATION: 76.85%
+    CPU 3:    SERVICE: 426    DISPATCH: 1424   IDLE: 664    UTILIZATION: 73.59%
+
+CORE CLASSES:
+    little:      CPUs 0-3     SPEED: 0.30    SERVICE: 1884   DISPATCH: 5982   BUSY: 7866   UTILIZATION: 78.22%
+
+PRIORITY SHIFT (vs. every CPU at speed 1.00):
+                    Response   Reference       Shift  Turnaround   Reference       Shift
+    SYSTEM              0.00        0.00       +0.00        0.00        0.00       +0.00
+    INTERACTIVE        35.00       35.00       +0.00     2042.67      939.00    +1103.67
+    NORMAL             37.25       37.25       +0.00     1341.75      580.00     +761.75
+    BATCH               0.00        0.00       +0.00        0.00        0.00       +0.00
+
+SMT (slowdown 1.70):
+    Contended time:               382
+                               SMT on     SMT off      Change
+    Elapsed time:                2514        6856     -63.33%
+    Work per tick:               0.25        0.09    +172.71%
+    Threads per 1000 ticks:      2.78        1.02    +172.71%
+
+PRIORITY SHIFT (vs. SMT off):
+                    Response   Reference       Shift  Turnaround   Reference       Shift
+    SYSTEM              0.00        0.00       +0.00        0.00        0.00       +0.00
+    INTERACTIVE        35.00       33.33       +1.67     2042.67     6315.67    -4273.00
+    NORMAL             37.25       57.25      -20.00     1341.75     3772.75    -2431.00
+    BATCH               0.00        0.00       +0.00        0.00        0.00       +0.00
+